@@ -0,0 +1,527 @@
+// Headless load generator for a local CSP_NET instance (csp_net_load)
+//
+// Opens N Ajax sessions over Wt's bootstrap protocol, then replays
+// navigation between Home and Credits through the Navigation click signals
+// and hovers the Get Started button. Reports session creation rate,
+// request throughput, latency percentiles and server RSS per session.
+//
+//   csp_net_load [--host 127.0.0.1] [--port 8080] [--app /app]
+//                [--sessions 1000] [--threads 16] [--rounds 5] [--pid PID]
+//
+// Every session holds its own keep-alive connection, so N sessions stay
+// open on the server at once; the threads take turns driving them. Only
+// plain HTTP on localhost is spoken, so it runs fully offline.
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "components/ComponentFactory.h"
+#include "metrics/Histogram.h"
+#include "views/components/Navigation.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string host = "127.0.0.1";
+    std::uint16_t port = 8080;
+    std::string appPath = "/app";
+    std::size_t sessions = 1000;
+    std::size_t threads = 16;
+    std::size_t rounds = 5;
+    long serverPid = 0;
+};
+
+struct Response {
+    int status = 0;
+    std::string body;
+};
+
+// Blocking HTTP/1.1 client on one keep-alive connection
+class HttpConnection {
+public:
+    HttpConnection(const std::string& host, std::uint16_t port) : host_(host), port_(port) {}
+    ~HttpConnection() { close(); }
+    
+    HttpConnection(const HttpConnection&) = delete;
+    HttpConnection& operator=(const HttpConnection&) = delete;
+    
+    // False on any transport error; the next request reconnects
+    bool request(const char* method, const std::string& target, const std::string& body, Response& response) {
+        if (fd_ < 0 && !connect()) {
+            return false;
+        }
+        
+        std::string request = std::string(method) + " " + target + " HTTP/1.1\r\n"
+            "Host: " + host_ + ":" + std::to_string(port_) + "\r\n"
+            "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+            "Chrome/120.0 Safari/537.36 csp-net-load\r\n"
+            "Accept: */*\r\n"
+            "Connection: keep-alive\r\n";
+        if (!body.empty()) {
+            request += "Content-Type: application/x-www-form-urlencoded\r\n"
+                       "Content-Length: " + std::to_string(body.size()) + "\r\n";
+        }
+        request += "\r\n" + body;
+        
+        if (!sendAll(request) || !readResponse(response)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+    
+private:
+    bool connect() {
+        fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd_ < 0) {
+            return false;
+        }
+        int one = 1;
+        ::setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port_);
+        if (::inet_pton(AF_INET, host_.c_str(), &address.sin_addr) != 1 ||
+            ::connect(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            close();
+            return false;
+        }
+        buffer_.clear();
+        return true;
+    }
+    
+    void close() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+    
+    bool sendAll(const std::string& data) {
+        std::size_t sent = 0;
+        while (sent < data.size()) {
+            const auto n = ::send(fd_, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+    
+    // Reads until buffer_ holds at least size bytes
+    bool fill(std::size_t size) {
+        char chunk[16384];
+        while (buffer_.size() < size) {
+            const auto n = ::recv(fd_, chunk, sizeof(chunk), 0);
+            if (n <= 0) {
+                return false;
+            }
+            buffer_.append(chunk, static_cast<std::size_t>(n));
+        }
+        return true;
+    }
+    
+    // Reads until buffer_ contains delimiter; returns its position
+    bool fillUntil(const char* delimiter, std::size_t from, std::size_t& position) {
+        while ((position = buffer_.find(delimiter, from)) == std::string::npos) {
+            if (!fill(buffer_.size() + 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    bool readResponse(Response& response) {
+        std::size_t headerEnd;
+        if (!fillUntil("\r\n\r\n", 0, headerEnd)) {
+            return false;
+        }
+        const auto headers = buffer_.substr(0, headerEnd);
+        buffer_.erase(0, headerEnd + 4);
+        
+        response.status = headers.size() > 12 ? std::atoi(headers.c_str() + 9) : 0;
+        response.body.clear();
+        
+        std::string lower(headers);
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        
+        if (lower.find("transfer-encoding: chunked") != std::string::npos) {
+            for (;;) {
+                std::size_t lineEnd;
+                if (!fillUntil("\r\n", 0, lineEnd)) {
+                    return false;
+                }
+                const auto size = std::strtoul(buffer_.c_str(), nullptr, 16);
+                buffer_.erase(0, lineEnd + 2);
+                if (!fill(size + 2)) {
+                    return false;
+                }
+                response.body.append(buffer_, 0, size);
+                buffer_.erase(0, size + 2);
+                if (size == 0) {
+                    return true;
+                }
+            }
+        }
+        
+        std::size_t length = 0;
+        const auto field = lower.find("content-length:");
+        if (field != std::string::npos) {
+            length = std::strtoul(lower.c_str() + field + 15, nullptr, 10);
+        }
+        if (!fill(length)) {
+            return false;
+        }
+        response.body.assign(buffer_, 0, length);
+        buffer_.erase(0, length);
+        return true;
+    }
+    
+    std::string host_;
+    std::uint16_t port_;
+    int fd_ = -1;
+    std::string buffer_;
+};
+
+// Per-operation request latencies, shared by all threads
+struct Stats {
+    CSPNet::Metrics::Histogram bootstrap;
+    CSPNet::Metrics::Histogram navigate;
+    CSPNet::Metrics::Histogram hover;
+    std::atomic<std::uint64_t> requests{0};
+    std::atomic<std::uint64_t> failures{0};
+    std::atomic<std::uint64_t> clientSideHovers{0};
+};
+
+// A DOM element of the rendered session and the signal its event emits
+struct Target {
+    std::string elementId;
+    std::string signal;
+};
+
+// One Wt Ajax session, driven the way Wt.js drives it from a browser
+class Session {
+public:
+    Session(const Options& options, Stats& stats)
+        : options_(options), stats_(stats), connection_(options.host, options.port) {}
+    
+    // Bootstrap page, then the application script holding the first render
+    bool open() {
+        Response page;
+        if (!timed(stats_.bootstrap, "GET", options_.appPath, "", page)) {
+            return false;
+        }
+        
+        std::smatch match;
+        static const std::regex sessionPattern("wtd=([0-9A-Za-z]+)");
+        if (!std::regex_search(page.body, match, sessionPattern)) {
+            return false;
+        }
+        sessionId_ = match[1];
+        
+        static const std::regex scriptPattern("src=\"([^\"]*request=script[^\"]*)\"");
+        std::string script = options_.appPath + "?wtd=" + sessionId_ + "&request=script";
+        if (std::regex_search(page.body, match, scriptPattern)) {
+            script = unescapeHtml(match[1]);
+            if (script.front() == '?') {
+                script = options_.appPath + script;
+            }
+        }
+        
+        Response application;
+        if (!timed(stats_.bootstrap, "GET", script, "", application)) {
+            return false;
+        }
+        learn(application.body);
+        
+        using CSPNet::Views::Components::NavigationMenu;
+        home_ = find(application.body, NavigationMenu::itemName("home").c_str(), "click");
+        credits_ = find(application.body, NavigationMenu::itemName("credits").c_str(), "click");
+        getStarted_ = find(application.body, CSPNet::Components::ComponentFactory::getStartedButtonName,
+                           "mouseover");
+        return !credits_.signal.empty() && !home_.signal.empty();
+    }
+    
+    // Credits, a look at Home's call to action, and back
+    void replay() {
+        click(credits_);
+        click(home_);
+        hover();
+    }
+    
+private:
+    void click(const Target& target) {
+        emit(stats_.navigate, target, "click");
+    }
+    
+    // Hover effects are CSS-only (see Components::Interactions); a browser
+    // only sends a request if the button still binds a mouseover signal
+    void hover() {
+        if (getStarted_.signal.empty()) {
+            stats_.clientSideHovers.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        emit(stats_.hover, getStarted_, "mouseover");
+    }
+    
+    void emit(CSPNet::Metrics::Histogram& histogram, const Target& target, const char* type) {
+        const auto body = "request=jsupdate&wtd=" + sessionId_ +
+            "&ackId=" + std::to_string(ackId_) + "&pageId=" + pageId_ +
+            "&e0signal=" + target.signal + "&e0id=" + target.elementId + "&e0type=" + type;
+        
+        Response response;
+        if (timed(histogram, "POST", options_.appPath + "?wtd=" + sessionId_, body, response)) {
+            learn(response.body);
+        }
+    }
+    
+    bool timed(CSPNet::Metrics::Histogram& histogram, const char* method, const std::string& target,
+               const std::string& body, Response& response) {
+        const auto start = Clock::now();
+        const bool ok = connection_.request(method, target, body, response) && response.status == 200;
+        histogram.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+        
+        stats_.requests.fetch_add(1, std::memory_order_relaxed);
+        if (!ok) {
+            stats_.failures.fetch_add(1, std::memory_order_relaxed);
+        }
+        return ok;
+    }
+    
+    // Every response carries the update id the next request must acknowledge
+    void learn(const std::string& script) {
+        static const std::regex ackPattern("ackUpdateId\\s*=\\s*(\\d+)");
+        static const std::regex pagePattern("pageId\\s*=\\s*(\\d+)");
+        std::smatch match;
+        if (std::regex_search(script, match, ackPattern)) {
+            ackId_ = std::stoul(match[1]);
+        }
+        if (std::regex_search(script, match, pagePattern)) {
+            pageId_ = match[1];
+        }
+    }
+    
+    // Finds the element with the given data-object-name and the signal its
+    // <event> handler passes to Wt._p_.update; the signal is empty when no
+    // server-side handler is bound
+    static Target find(const std::string& script, const char* objectName, const char* event) {
+        Target target;
+        const auto marker = std::string("data-object-name=\\\"") + objectName;
+        auto position = script.find(marker);
+        if (position == std::string::npos) {
+            return target;
+        }
+        
+        const auto tagStart = script.rfind('<', position);
+        const auto tagEnd = script.find('>', position);
+        const auto tag = script.substr(tagStart, tagEnd - tagStart);
+        std::smatch match;
+        static const std::regex idPattern("id=\\\\\"(\\w+)\\\\\"");
+        if (!std::regex_search(tag, match, idPattern)) {
+            return target;
+        }
+        target.elementId = match[1];
+        
+        // Handlers are attached by id, either as on<event> or addEventListener
+        const std::regex handlerPattern(
+            "'" + target.elementId + "'\\)(?:\\.on" + event + "\\s*=|\\.addEventListener\\('" + event +
+            "')[^;]*?update\\([^,]*,\\s*'(\\w+)'");
+        if (std::regex_search(script, match, handlerPattern)) {
+            target.signal = match[1];
+        }
+        return target;
+    }
+    
+    static std::string unescapeHtml(std::string text) {
+        for (std::size_t at; (at = text.find("&amp;")) != std::string::npos;) {
+            text.replace(at, 5, "&");
+        }
+        return text;
+    }
+    
+    const Options& options_;
+    Stats& stats_;
+    HttpConnection connection_;
+    std::string sessionId_;
+    std::string pageId_ = "0";
+    unsigned long ackId_ = 0;
+    Target home_;
+    Target credits_;
+    Target getStarted_;
+};
+
+// Resident set size of a process in bytes; 0 if unavailable
+std::uint64_t residentBytes(long pid) {
+    std::ifstream status("/proc/" + std::to_string(pid) + "/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+        }
+    }
+    return 0;
+}
+
+// First process named CSP_NET
+long findServerPid() {
+    long found = 0;
+    if (auto dir = ::opendir("/proc")) {
+        while (auto entry = ::readdir(dir)) {
+            const long pid = std::strtol(entry->d_name, nullptr, 10);
+            if (pid <= 0) {
+                continue;
+            }
+            std::ifstream comm("/proc/" + std::to_string(pid) + "/comm");
+            std::string name;
+            if (std::getline(comm, name) && name == "CSP_NET") {
+                found = pid;
+                break;
+            }
+        }
+        ::closedir(dir);
+    }
+    return found;
+}
+
+// Runs work(session index) for all sessions, spread over the threads
+template <typename Work>
+double runParallel(std::size_t sessions, std::size_t threads, Work work) {
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> workers;
+    const auto start = Clock::now();
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            for (std::size_t i; (i = next.fetch_add(1)) < sessions;) {
+                work(i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void printLatency(const char* name, const CSPNet::Metrics::Histogram& histogram) {
+    const auto snapshot = histogram.snapshot();
+    if (snapshot.count == 0) {
+        std::printf("  %-10s no requests\n", name);
+        return;
+    }
+    std::printf("  %-10s n=%-8llu p50=%8.2fms p90=%8.2fms p99=%8.2fms p99.9=%8.2fms\n", name,
+                static_cast<unsigned long long>(snapshot.count),
+                snapshot.valueAt(0.5) / 1e6, snapshot.valueAt(0.9) / 1e6,
+                snapshot.valueAt(0.99) / 1e6, snapshot.valueAt(0.999) / 1e6);
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string arg = argv[i];
+        const char* value = argv[i + 1];
+        if (arg == "--host") {
+            options.host = value;
+        } else if (arg == "--port") {
+            options.port = static_cast<std::uint16_t>(std::stoul(value));
+        } else if (arg == "--app") {
+            options.appPath = value;
+        } else if (arg == "--sessions") {
+            options.sessions = std::max<std::size_t>(1, std::stoul(value));
+        } else if (arg == "--threads") {
+            options.threads = std::max<std::size_t>(1, std::stoul(value));
+        } else if (arg == "--rounds") {
+            options.rounds = std::stoul(value);
+        } else if (arg == "--pid") {
+            options.serverPid = std::stol(value);
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    if (options.serverPid == 0) {
+        options.serverPid = findServerPid();
+    }
+    
+    Stats stats;
+    std::vector<std::unique_ptr<Session>> sessions;
+    for (std::size_t i = 0; i < options.sessions; ++i) {
+        sessions.push_back(std::make_unique<Session>(options, stats));
+    }
+    std::vector<char> opened(options.sessions, 0);
+    
+    const auto rssBefore = options.serverPid ? residentBytes(options.serverPid) : 0;
+    
+    // Phase 1: open every session and keep it alive
+    const auto openSeconds = runParallel(options.sessions, options.threads, [&](std::size_t i) {
+        opened[i] = sessions[i]->open();
+    });
+    const auto openCount = static_cast<std::size_t>(std::count(opened.begin(), opened.end(), 1));
+    const auto rssAfter = options.serverPid ? residentBytes(options.serverPid) : 0;
+    
+    // Phase 2: replay navigation on all live sessions
+    const auto requestsBefore = stats.requests.load();
+    double replaySeconds = 0;
+    for (std::size_t round = 0; round < options.rounds; ++round) {
+        replaySeconds += runParallel(options.sessions, options.threads, [&](std::size_t i) {
+            if (opened[i]) {
+                sessions[i]->replay();
+            }
+        });
+    }
+    const auto replayRequests = stats.requests.load() - requestsBefore;
+    
+    std::printf("CSP-NET load: %zu sessions, %zu threads, %zu rounds against %s:%u%s\n",
+                options.sessions, options.threads, options.rounds,
+                options.host.c_str(), static_cast<unsigned>(options.port), options.appPath.c_str());
+    std::printf("Sessions opened:   %zu/%zu in %.2fs (%.1f sessions/s)\n",
+                openCount, options.sessions, openSeconds, openCount / std::max(openSeconds, 1e-9));
+    std::printf("Replay throughput: %llu requests in %.2fs (%.1f req/s)\n",
+                static_cast<unsigned long long>(replayRequests), replaySeconds,
+                replayRequests / std::max(replaySeconds, 1e-9));
+    std::printf("Failed requests:   %llu\n", static_cast<unsigned long long>(stats.failures.load()));
+    std::printf("Hovers resolved client-side: %llu\n",
+                static_cast<unsigned long long>(stats.clientSideHovers.load()));
+    std::printf("Latency:\n");
+    printLatency("bootstrap", stats.bootstrap);
+    printLatency("navigate", stats.navigate);
+    printLatency("hover", stats.hover);
+    
+    if (options.serverPid && openCount > 0) {
+        std::printf("Server RSS (pid %ld): %.1f MiB -> %.1f MiB, %.1f KiB per session\n",
+                    options.serverPid, rssBefore / 1048576.0, rssAfter / 1048576.0,
+                    (static_cast<double>(rssAfter) - static_cast<double>(rssBefore)) / 1024.0 / openCount);
+    } else {
+        std::printf("Server RSS: unavailable (pass --pid)\n");
+    }
+    return stats.failures.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,362 @@
+// Session construction microbenchmarks (csp_net_bench)
+//
+// Builds Application instances against Wt::Test::WTestEnvironment and
+// reports time, heap allocations, widgets and rendered bootstrap bytes per
+// session, per setup phase. Also compares the three Home page construction
+// paths: Views::Pages::HomePage, Builders::HomePageBuilder (a shared
+// template) and plain Components::ComponentFactory calls.
+//
+//   csp_net_bench [--sessions N] [--out results.txt]
+//                 [--baseline results.txt] [--tolerance 0.10]
+//
+// With --baseline the run fails if allocations, widgets or bytes grew, or
+// if time grew by more than the tolerance.
+#include <Wt/Test/WTestEnvironment.h>
+#include <Wt/WApplication.h>
+#include <Wt/WContainerWidget.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "app/Application.h"
+#include "app/SetupPhase.h"
+#include "builders/HomePageBuilder.h"
+#include "components/ComponentFactory.h"
+#include "logging/Logger.h"
+#include "models/ContentSnapshot.h"
+#include "views/pages/HomePage.h"
+
+// Heap accounting for the calling thread
+namespace {
+
+thread_local std::uint64_t allocationCount = 0;
+thread_local std::uint64_t allocatedBytes = 0;
+
+void* countedAlloc(std::size_t size) {
+    ++allocationCount;
+    allocatedBytes += size;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Sample {
+    double nanoseconds = 0;
+    std::uint64_t allocations = 0;
+    std::uint64_t allocatedBytes = 0;
+    std::uint64_t widgets = 0;
+    std::uint64_t bytes = 0;
+};
+
+struct Counters {
+    Clock::time_point time;
+    std::uint64_t allocations;
+    std::uint64_t allocatedBytes;
+    
+    static Counters now() { return { Clock::now(), allocationCount, allocatedBytes }; }
+};
+
+std::uint64_t countWidgets(Wt::WWidget* widget) {
+    std::uint64_t count = 1;
+    for (auto child : widget->children()) {
+        count += countWidgets(child);
+    }
+    return count;
+}
+
+std::uint64_t renderedBytes(Wt::WWidget* widget) {
+    std::ostringstream html;
+    widget->htmlText(html);
+    return static_cast<std::uint64_t>(html.tellp());
+}
+
+// Attributes each setup phase's cost to that phase. Widgets and bytes are
+// read from the whole tree at phase end, so they are deltas from the
+// previous phase; reading them is excluded from time and allocations.
+class PhaseRecorder : public CSPNet::App::SetupPhaseProbe {
+public:
+    PhaseRecorder(std::map<std::string, std::vector<Sample>>& samples, bool renderBytes)
+        : samples_(samples), renderBytes_(renderBytes) {}
+    
+    void begin(const char*) override {
+        start_ = Counters::now();
+    }
+    
+    void end(const char* phase) override {
+        const auto stop = Counters::now();
+        Sample sample;
+        sample.nanoseconds = std::chrono::duration<double, std::nano>(stop.time - start_.time).count();
+        sample.allocations = stop.allocations - start_.allocations;
+        sample.allocatedBytes = stop.allocatedBytes - start_.allocatedBytes;
+        
+        // Pause heap accounting while inspecting the tree
+        auto app = Wt::WApplication::instance();
+        if (app && app->root()) {
+            const auto widgets = countWidgets(app->root());
+            sample.widgets = widgets - std::min(widgets, widgets_);
+            widgets_ = widgets;
+            if (renderBytes_) {
+                const auto bytes = renderedBytes(app->root());
+                sample.bytes = bytes - std::min(bytes, bytes_);
+                bytes_ = bytes;
+            }
+        }
+        allocationCount = stop.allocations;
+        allocatedBytes = stop.allocatedBytes;
+        overhead_ += std::chrono::duration<double, std::nano>(Clock::now() - stop.time).count();
+        
+        samples_[phase].push_back(sample);
+    }
+    
+    // Time spent inspecting the tree, to subtract from the session total
+    double overhead() const { return overhead_; }
+    
+    void reset() {
+        widgets_ = 0;
+        bytes_ = 0;
+        overhead_ = 0;
+    }
+    
+private:
+    std::map<std::string, std::vector<Sample>>& samples_;
+    bool renderBytes_;
+    Counters start_{};
+    std::uint64_t widgets_ = 0;
+    std::uint64_t bytes_ = 0;
+    double overhead_ = 0;
+};
+
+// Median time, mean of the (deterministic) counts
+Sample summarize(std::vector<Sample> samples) {
+    Sample result;
+    if (samples.empty()) {
+        return result;
+    }
+    std::sort(samples.begin(), samples.end(),
+              [](const Sample& a, const Sample& b) { return a.nanoseconds < b.nanoseconds; });
+    result.nanoseconds = samples[samples.size() / 2].nanoseconds;
+    for (const auto& sample : samples) {
+        result.allocations += sample.allocations;
+        result.allocatedBytes += sample.allocatedBytes;
+        result.widgets += sample.widgets;
+        result.bytes += sample.bytes;
+    }
+    result.allocations /= samples.size();
+    result.allocatedBytes /= samples.size();
+    result.widgets /= samples.size();
+    result.bytes /= samples.size();
+    return result;
+}
+
+// Session construction, broken down by setup phase
+std::map<std::string, Sample> benchSessions(int sessions) {
+    std::map<std::string, std::vector<Sample>> timed;
+    std::map<std::string, std::vector<Sample>> rendered;
+    
+    // Timing pass, then a separate pass that renders at each phase end
+    for (auto renderBytes : { false, true }) {
+        auto& samples = renderBytes ? rendered : timed;
+        PhaseRecorder recorder(samples, renderBytes);
+        CSPNet::App::SetupPhaseProbe::current() = &recorder;
+        
+        for (int i = 0; i < sessions; ++i) {
+            Wt::Test::WTestEnvironment env;
+            recorder.reset();
+            
+            const auto start = Counters::now();
+            auto app = CSPNet::App::createApplication(env);
+            const auto stop = Counters::now();
+            
+            Sample total;
+            total.nanoseconds = std::chrono::duration<double, std::nano>(stop.time - start.time).count()
+                - recorder.overhead();
+            total.allocations = stop.allocations - start.allocations;
+            total.allocatedBytes = stop.allocatedBytes - start.allocatedBytes;
+            total.widgets = countWidgets(app->root());
+            if (renderBytes) {
+                total.bytes = renderedBytes(app->root());
+            }
+            samples["session"].push_back(total);
+        }
+        CSPNet::App::SetupPhaseProbe::current() = nullptr;
+    }
+    
+    std::map<std::string, Sample> results;
+    for (auto& [phase, samples] : timed) {
+        auto summary = summarize(samples);
+        summary.bytes = summarize(rendered[phase]).bytes;
+        results["session." + phase] = summary;
+    }
+    return results;
+}
+
+// One Home page construction path, built under a bare WApplication
+Sample benchPagePath(int iterations, const std::function<std::unique_ptr<Wt::WWidget>()>& build) {
+    std::vector<Sample> samples;
+    for (int i = 0; i < iterations; ++i) {
+        Wt::Test::WTestEnvironment env;
+        Wt::WApplication app(env);
+        
+        const auto start = Counters::now();
+        auto page = build();
+        const auto stop = Counters::now();
+        
+        Sample sample;
+        sample.nanoseconds = std::chrono::duration<double, std::nano>(stop.time - start.time).count();
+        sample.allocations = stop.allocations - start.allocations;
+        sample.allocatedBytes = stop.allocatedBytes - start.allocatedBytes;
+        sample.widgets = countWidgets(page.get());
+        sample.bytes = renderedBytes(app.root()->addWidget(std::move(page)));
+        samples.push_back(sample);
+    }
+    return summarize(std::move(samples));
+}
+
+std::map<std::string, Sample> benchPagePaths(int iterations) {
+    using namespace CSPNet;
+    std::map<std::string, Sample> results;
+    
+    results["home.views_page"] = benchPagePath(iterations, []() -> std::unique_ptr<Wt::WWidget> {
+        return std::make_unique<Views::Pages::HomePage>();
+    });
+    results["home.builder"] = benchPagePath(iterations, []() -> std::unique_ptr<Wt::WWidget> {
+        return Builders::HomePageBuilder::create();
+    });
+    results["home.component_factory"] = benchPagePath(iterations, []() -> std::unique_ptr<Wt::WWidget> {
+        auto page = std::make_unique<Wt::WContainerWidget>();
+        auto content = Models::AppData::snapshot();
+        for (const auto& feature : content->features()) {
+            Components::ComponentFactory::createFeatureCard(page.get(), feature.title, feature.description);
+        }
+        Components::ComponentFactory::createGetStartedButton(page.get());
+        return page;
+    });
+    return results;
+}
+
+// "name metric value" lines, one per metric
+void writeResults(std::ostream& out, const std::map<std::string, Sample>& results) {
+    for (const auto& [name, sample] : results) {
+        out << name << " ns " << static_cast<std::uint64_t>(sample.nanoseconds) << '\n'
+            << name << " allocations " << sample.allocations << '\n'
+            << name << " allocated_bytes " << sample.allocatedBytes << '\n'
+            << name << " widgets " << sample.widgets << '\n'
+            << name << " bytes " << sample.bytes << '\n';
+    }
+}
+
+void printTable(const std::map<std::string, Sample>& results) {
+    std::cout << std::left << std::setw(32) << "benchmark" << std::right
+              << std::setw(12) << "median us" << std::setw(10) << "allocs"
+              << std::setw(12) << "heap B" << std::setw(10) << "widgets"
+              << std::setw(10) << "html B" << '\n';
+    for (const auto& [name, sample] : results) {
+        std::cout << std::left << std::setw(32) << name << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(1) << sample.nanoseconds / 1000.0
+                  << std::setw(10) << sample.allocations << std::setw(12) << sample.allocatedBytes
+                  << std::setw(10) << sample.widgets << std::setw(10) << sample.bytes << '\n';
+    }
+}
+
+// Number of regressions against a file written by --out
+int compareBaseline(const std::string& path, const std::map<std::string, Sample>& results, double tolerance) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Cannot read baseline " << path << std::endl;
+        return 1;
+    }
+    
+    std::ostringstream current;
+    writeResults(current, results);
+    std::map<std::string, double> now;
+    std::istringstream lines(current.str());
+    std::string name, metric;
+    double value;
+    while (lines >> name >> metric >> value) {
+        now[name + " " + metric] = value;
+    }
+    
+    int regressions = 0;
+    while (in >> name >> metric >> value) {
+        auto found = now.find(name + " " + metric);
+        if (found == now.end()) {
+            continue;
+        }
+        const double limit = metric == "ns" ? value * (1.0 + tolerance) : value;
+        if (found->second > limit) {
+            std::cerr << "Regression: " << name << " " << metric << " " << value
+                      << " -> " << found->second << std::endl;
+            ++regressions;
+        }
+    }
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int sessions = 200;
+    double tolerance = 0.10;
+    std::string outPath;
+    std::string baselinePath;
+    
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string arg = argv[i];
+        if (arg == "--sessions") {
+            sessions = std::max(1, std::atoi(argv[i + 1]));
+        } else if (arg == "--out") {
+            outPath = argv[i + 1];
+        } else if (arg == "--baseline") {
+            baselinePath = argv[i + 1];
+        } else if (arg == "--tolerance") {
+            tolerance = std::atof(argv[i + 1]);
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return 2;
+        }
+    }
+    
+    // Handlers log at info level; keep the writer quiet during the run
+    CSPNet::Logging::Logger::setLevel(CSPNet::Logging::Level::Warn);
+    CSPNet::Logging::Logger::start();
+    
+    auto results = benchSessions(sessions);
+    auto pages = benchPagePaths(sessions);
+    results.insert(pages.begin(), pages.end());
+    
+    CSPNet::Logging::Logger::stop();
+    
+    printTable(results);
+    if (!outPath.empty()) {
+        std::ofstream out(outPath);
+        writeResults(out, results);
+    }
+    if (!baselinePath.empty()) {
+        return compareBaseline(baselinePath, results, tolerance) == 0 ? 0 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include "ApiClient.h"
+#include <drogon/HttpClient.h>
+#include <mutex>
+
+namespace CSPNet {
+namespace Api {
+
+namespace {
+
+std::mutex clientMutex;
+drogon::HttpClientPtr client;
+
+drogon::HttpClientPtr currentClient() {
+    std::lock_guard<std::mutex> lock(clientMutex);
+    return client;
+}
+
+} // namespace
+
+void ApiClient::start(const ApiServerConfig& config) {
+    // A wildcard listener is reached over loopback
+    const auto host = config.address == "0.0.0.0" ? std::string("127.0.0.1") : config.address;
+    auto created = drogon::HttpClient::newHttpClient("http://" + host + ":" + std::to_string(config.port));
+    
+    std::lock_guard<std::mutex> lock(clientMutex);
+    client = std::move(created);
+}
+
+void ApiClient::stop() {
+    std::lock_guard<std::mutex> lock(clientMutex);
+    client.reset();
+}
+
+void ApiClient::get(const std::string& path, Callback callback) {
+    auto http = currentClient();
+    if (!http) {
+        callback(ApiResponse());
+        return;
+    }
+    
+    auto request = drogon::HttpRequest::newHttpRequest();
+    request->setMethod(drogon::Get);
+    request->setPath(path);
+    http->sendRequest(request, [callback = std::move(callback)](drogon::ReqResult result,
+                                                                const drogon::HttpResponsePtr& response) {
+        ApiResponse reply;
+        if (result == drogon::ReqResult::Ok && response) {
+            reply.status = static_cast<int>(response->statusCode());
+            reply.ok = reply.status >= 200 && reply.status < 300;
+            reply.body = std::string(response->body());
+        }
+        callback(std::move(reply));
+    });
+}
+
+} // namespace Api
+} // namespace CSPNet
@@ -0,0 +1,30 @@
+#pragma once
+#include <functional>
+#include <string>
+#include "ApiServer.h"
+
+namespace CSPNet {
+namespace Api {
+
+struct ApiResponse {
+    bool ok = false;        // 2xx received
+    int status = 0;         // 0 when no response arrived
+    std::string body;
+};
+
+// Process-wide HTTP client for the Drogon API tier. Requests are sent on
+// Drogon's event loop; nothing blocks while they are in flight.
+class ApiClient {
+public:
+    // Targets the ApiServer listening with config; call after it started
+    static void start(const ApiServerConfig& config);
+    static void stop();
+    
+    // callback runs once on a Drogon thread; before start() and after
+    // stop() it runs at once with a failed response
+    using Callback = std::function<void(ApiResponse)>;
+    static void get(const std::string& path, Callback callback);
+};
+
+} // namespace Api
+} // namespace CSPNet
@@ -0,0 +1,169 @@
+#include "ApiServer.h"
+#include <drogon/drogon.h>
+#include <algorithm>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include "../models/ContentRepository.h"
+#include "../models/ContentSnapshot.h"
+#include "../tasks/TaskExecutor.h"
+#include "../utils/HttpCaching.h"
+
+namespace CSPNet {
+namespace Api {
+
+namespace {
+
+using Callback = std::function<void(const drogon::HttpResponsePtr&)>;
+
+void handleHealth(const drogon::HttpRequestPtr&, Callback&& callback) {
+    Json::Value body;
+    body["status"] = "ok";
+    body["service"] = "csp-net";
+    callback(drogon::HttpResponse::newHttpJsonResponse(body));
+}
+
+// Sends pre-serialized snapshot bytes; nothing is serialized or compressed per request
+void sendSerialized(const drogon::HttpRequestPtr& request, Callback&& callback,
+                    const Models::SerializedBody& body) {
+    const bool gzip = !body.gzip.empty() && Utils::acceptsGzip(request->getHeader("Accept-Encoding"));
+    const auto& etag = gzip ? body.gzipEtag : body.etag;
+    
+    auto response = drogon::HttpResponse::newHttpResponse();
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    if (!body.gzip.empty()) {
+        response->addHeader("Vary", "Accept-Encoding");
+    }
+    
+    if (Utils::etagMatches(request->getHeader("If-None-Match"), etag)) {
+        response->setStatusCode(drogon::k304NotModified);
+        callback(response);
+        return;
+    }
+    
+    response->setContentTypeCode(drogon::CT_APPLICATION_JSON);
+    if (gzip) {
+        response->addHeader("Content-Encoding", "gzip");
+        response->setBody(body.gzip);
+    } else {
+        response->setBody(body.json);
+    }
+    callback(response);
+}
+
+void handleFeatures(const drogon::HttpRequestPtr& request, Callback&& callback) {
+    auto snapshot = Models::AppData::snapshot();
+    sendSerialized(request, std::move(callback), snapshot->featuresJson());
+}
+
+constexpr std::int64_t defaultCreditPageSize = 100;
+constexpr std::int64_t maxCreditPageSize = 1000;
+
+// Empty reads as fallback; anything but a non-negative integer fails
+bool parseCount(const std::string& text, std::int64_t fallback, std::int64_t& out) {
+    if (text.empty()) {
+        out = fallback;
+        return true;
+    }
+    char* end = nullptr;
+    const auto value = std::strtoll(text.c_str(), &end, 10);
+    if (*end != '\0' || value < 0) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+void handleCredits(const drogon::HttpRequestPtr& request, Callback&& callback) {
+    const auto& fromParameter = request->getParameter("from");
+    const auto& limitParameter = request->getParameter("limit");
+    
+    // The whole list, precompressed, when the snapshot holds it and no page was asked for
+    auto repository = Models::AppData::repository();
+    if (repository->inSnapshot() && fromParameter.empty() && limitParameter.empty()) {
+        auto snapshot = Models::AppData::snapshot();
+        sendSerialized(request, std::move(callback), snapshot->creditsJson());
+        return;
+    }
+    
+    std::int64_t from;
+    std::int64_t limit;
+    if (!parseCount(fromParameter, 0, from) || !parseCount(limitParameter, defaultCreditPageSize, limit)) {
+        Json::Value body;
+        body["error"] = "from and limit must be non-negative integers";
+        auto response = drogon::HttpResponse::newHttpJsonResponse(body);
+        response->setStatusCode(drogon::k400BadRequest);
+        callback(response);
+        return;
+    }
+    limit = std::clamp(limit, std::int64_t{1}, maxCreditPageSize);
+    
+    // The read may go to a database, so it runs on the task pool and not on
+    // this IO loop; Drogon accepts the reply from any thread
+    Tasks::TaskExecutor::submit([repository, from, limit, callback = std::move(callback)]() {
+        // Keyset page: the next link carries the key to continue from
+        const auto page = repository->credits(from, static_cast<std::size_t>(limit));
+        auto response = drogon::HttpResponse::newHttpResponse();
+        response->setContentTypeCode(drogon::CT_APPLICATION_JSON);
+        response->addHeader("Cache-Control", "no-cache");
+        if (page.next >= 0) {
+            response->addHeader("Link", "</api/credits?from=" + std::to_string(page.next) +
+                                            "&limit=" + std::to_string(limit) + ">; rel=\"next\"");
+        }
+        response->setBody(Models::creditsToJson(page.credits));
+        callback(response);
+    });
+}
+
+} // namespace
+
+ApiServer::ApiServer(ApiServerConfig config) : config_(std::move(config)) {
+}
+
+ApiServer::~ApiServer() {
+    stop();
+}
+
+void ApiServer::start() {
+    registerRoutes();
+    
+    // Bodies are precompressed in the content snapshot, and Wt owns
+    // SIGINT/SIGTERM through WServer::waitForShutdown()
+    drogon::app()
+        .addListener(config_.address, config_.port)
+        .setThreadNum(config_.threads)
+        .enableGzip(false)
+        .disableSigtermHandling();
+    
+    // quit() is a no-op until the main loop runs, so start() returns only
+    // once it does; queued functors run as soon as the loop starts
+    auto started = std::make_shared<std::promise<void>>();
+    auto running = started->get_future();
+    drogon::app().getLoop()->queueInLoop([started]() {
+        started->set_value();
+    });
+    
+    // Drogon moves its main loop to whichever thread calls run()
+    thread_ = std::thread([]() {
+        drogon::app().run();
+    });
+    running.wait();
+}
+
+void ApiServer::stop() {
+    if (thread_.joinable()) {
+        drogon::app().quit();
+        thread_.join();
+    }
+}
+
+void ApiServer::registerRoutes() {
+    drogon::app()
+        .registerHandler("/api/health", &handleHealth, {drogon::Get})
+        .registerHandler("/api/features", &handleFeatures, {drogon::Get})
+        .registerHandler("/api/credits", &handleCredits, {drogon::Get});
+}
+
+} // namespace Api
+} // namespace CSPNet
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace CSPNet {
+namespace Api {
+
+struct ApiServerConfig {
+    std::string address = "0.0.0.0";
+    std::uint16_t port = 8081;
+    // Drogon IO threads, independent of the Wt server's thread pool
+    std::size_t threads = 2;
+};
+
+// JSON API tier served by Drogon next to the Wt server. Handlers answer
+// from the current Models::ContentSnapshot and never touch a Wt session
+// or its lock.
+class ApiServer {
+public:
+    explicit ApiServer(ApiServerConfig config = ApiServerConfig());
+    ~ApiServer();
+    
+    ApiServer(const ApiServer&) = delete;
+    ApiServer& operator=(const ApiServer&) = delete;
+    
+    void start();
+    void stop();
+    
+    const ApiServerConfig& config() const { return config_; }
+    
+private:
+    ApiServerConfig config_;
+    std::thread thread_;
+    
+    void registerRoutes();
+};
+
+} // namespace Api
+} // namespace CSPNet
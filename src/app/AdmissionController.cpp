@@ -0,0 +1,214 @@
+#include "AdmissionController.h"
+#include <Wt/WEnvironment.h>
+#include <Wt/WIOService.h>
+#include <Wt/WServer.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include "../logging/Logger.h"
+#include "../memory/AllocationTracker.h"
+#include "../views/pages/StaticPages.h"
+
+namespace CSPNet {
+namespace App {
+
+namespace {
+
+std::int64_t steadyMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::uint64_t residentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    std::uint64_t size = 0;
+    std::uint64_t resident = 0;
+    statm >> size >> resident;
+    return resident * static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+}
+
+// A task posted to the server's event queue, timestamped; the delay until
+// it runs is how long session events currently wait. Shared with the task
+// so a late run after stop() is harmless.
+struct QueueProbe {
+    std::atomic<std::int64_t> postedAt{0};
+    std::atomic<std::int64_t> lastDelay{0};
+};
+
+} // namespace
+
+// Counts a session for as long as its application lives
+class AdmissionController::SessionTicket : public Wt::WObject {
+public:
+    explicit SessionTicket(std::shared_ptr<std::atomic<std::size_t>> sessions)
+        : sessions_(std::move(sessions)) {
+        sessions_->fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    ~SessionTicket() override {
+        sessions_->fetch_sub(1, std::memory_order_relaxed);
+    }
+    
+private:
+    std::shared_ptr<std::atomic<std::size_t>> sessions_;
+};
+
+AdmissionController::AdmissionController(AdmissionPolicy policy)
+    : policy_(policy), liveSessions_(std::make_shared<std::atomic<std::size_t>>(0)) {
+}
+
+AdmissionController::~AdmissionController() {
+    stop();
+}
+
+void AdmissionController::start(Wt::WServer& server) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    sampler_ = std::thread(&AdmissionController::sampleLoop, this, &server);
+}
+
+void AdmissionController::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    wake_.notify_all();
+    if (sampler_.joinable()) {
+        sampler_.join();
+    }
+}
+
+std::string AdmissionController::entryUrl(const std::string& internalPath) {
+    if (!admit()) {
+        refused_.fetch_add(1, std::memory_order_relaxed);
+        return overflowUrl(internalPath);
+    }
+    std::string url = Views::Pages::StaticPages::applicationUrl;
+    if (!internalPath.empty()) {
+        // Wt's query parameter for the initial internal path
+        url += "?_=" + internalPath;
+    }
+    return url;
+}
+
+AdmissionController::Factory AdmissionController::wrap(Factory factory) {
+    return [this, factory = std::move(factory)](const Wt::WEnvironment& env) {
+        if (!admit()) {
+            refused_.fetch_add(1, std::memory_order_relaxed);
+            refusedSessions_.fetch_add(1, std::memory_order_relaxed);
+            return turnAway(env);
+        }
+        admitted_.fetch_add(1, std::memory_order_relaxed);
+        
+        // Counted before the build, so a burst sees its own sessions
+        auto ticket = std::make_unique<SessionTicket>(liveSessions_);
+        auto app = factory(env);
+        app->addChild(std::move(ticket));
+        return app;
+    };
+}
+
+bool AdmissionController::admit() {
+    if (overloaded_.load(std::memory_order_relaxed)) {
+        bool expected = true;
+        if (!overWatermark(policy_.resumeRatio) && overloaded_.compare_exchange_strong(expected, false)) {
+            CSP_LOG_INFO("Admission: load back under watermarks, admitting new sessions");
+        }
+    } else {
+        bool expected = false;
+        if (overWatermark(1.0) && overloaded_.compare_exchange_strong(expected, true)) {
+            CSP_LOG_WARN("Admission: {} sessions, {} bytes RSS, {}us queue delay; turning new visitors away",
+                         liveSessions(), rssBytes_.load(), queueDelayMicros_.load());
+        }
+    }
+    return !overloaded_.load(std::memory_order_relaxed);
+}
+
+bool AdmissionController::overWatermark(double ratio) const {
+    auto over = [ratio](double value, double mark) {
+        return mark > 0 && value > mark * ratio;
+    };
+    return over(static_cast<double>(liveSessions()), static_cast<double>(policy_.maxSessions)) ||
+           over(static_cast<double>(rssBytes_.load()), static_cast<double>(policy_.maxRssBytes)) ||
+           over(static_cast<double>(sessionMemoryBytes_.load()), static_cast<double>(policy_.maxSessionMemoryBytes)) ||
+           over(static_cast<double>(queueDelayMicros_.load()),
+                static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(policy_.maxQueueDelay).count()));
+}
+
+// The pre-rendered copy of whatever page was asked for, or the queue page,
+// which retries the gate after a short wait
+std::string AdmissionController::overflowUrl(const std::string& internalPath) const {
+    using Views::Pages::StaticPages;
+    if (policy_.overflow == AdmissionPolicy::Overflow::QueuePage) {
+        return StaticPages::queueUrl;
+    }
+    if (internalPath.compare(0, 8, "/credits") == 0) {
+        return StaticPages::creditsUrl;
+    }
+    return StaticPages::homeUrl;
+}
+
+std::unique_ptr<Wt::WApplication> AdmissionController::turnAway(const Wt::WEnvironment& env) {
+    auto app = std::make_unique<Wt::WApplication>(env);
+    app->redirect(overflowUrl(env.internalPath()));
+    app->quit();
+    return app;
+}
+
+void AdmissionController::sampleLoop(Wt::WServer* server) {
+    auto probe = std::make_shared<QueueProbe>();
+    
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        lock.unlock();
+        
+        rssBytes_.store(residentBytes(), std::memory_order_relaxed);
+        sessionMemoryBytes_.store(Memory::SessionAccount::totalLiveBytes(), std::memory_order_relaxed);
+        
+        // One probe in flight at a time; while it waits, its age is the delay
+        const auto now = steadyMicros();
+        const auto postedAt = probe->postedAt.load();
+        if (postedAt == 0) {
+            probe->postedAt.store(now);
+            server->ioService().post([probe]() {
+                probe->lastDelay.store(steadyMicros() - probe->postedAt.load());
+                probe->postedAt.store(0);
+            });
+        }
+        const auto pending = postedAt == 0 ? 0 : now - postedAt;
+        queueDelayMicros_.store(std::max(probe->lastDelay.load(), pending), std::memory_order_relaxed);
+        
+        lock.lock();
+        wake_.wait_for(lock, policy_.sampleInterval, [this]() { return !running_; });
+    }
+}
+
+std::string AdmissionController::renderPrometheus() const {
+    std::string out;
+    out += "# HELP csp_net_sessions Live application sessions.\n"
+           "# TYPE csp_net_sessions gauge\n"
+           "csp_net_sessions " + std::to_string(liveSessions()) + "\n"
+           "# HELP csp_net_admission_overloaded 1 while new visitors are turned away.\n"
+           "# TYPE csp_net_admission_overloaded gauge\n"
+           "csp_net_admission_overloaded " + std::string(overloaded() ? "1" : "0") + "\n"
+           "# HELP csp_net_event_queue_delay_seconds Time a task waits in the server's event queue.\n"
+           "# TYPE csp_net_event_queue_delay_seconds gauge\n"
+           "csp_net_event_queue_delay_seconds " + std::to_string(queueDelayMicros_.load() / 1e6) + "\n"
+           "# HELP csp_net_process_resident_bytes Resident set size of the server.\n"
+           "# TYPE csp_net_process_resident_bytes gauge\n"
+           "csp_net_process_resident_bytes " + std::to_string(rssBytes_.load()) + "\n"
+           "# HELP csp_net_admissions_total New visitors by admission decision.\n"
+           "# TYPE csp_net_admissions_total counter\n"
+           "csp_net_admissions_total{decision=\"admitted\"} " + std::to_string(admitted_.load()) + "\n"
+           "csp_net_admissions_total{decision=\"refused\"} " + std::to_string(refused_.load()) + "\n"
+           "# HELP csp_net_admission_refused_sessions_total Refused visitors who bypassed the gate and got a redirect session.\n"
+           "# TYPE csp_net_admission_refused_sessions_total counter\n"
+           "csp_net_admission_refused_sessions_total " + std::to_string(refusedSessions_.load()) + "\n";
+    return out;
+}
+
+} // namespace App
+} // namespace CSPNet
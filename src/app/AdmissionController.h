@@ -0,0 +1,99 @@
+#pragma once
+#include <Wt/WApplication.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Wt {
+class WServer;
+}
+
+namespace CSPNet {
+namespace App {
+
+// Watermarks above which new visitors are turned away; 0 disables one
+struct AdmissionPolicy {
+    enum class Overflow { StaticPages, QueuePage };
+    
+    std::size_t maxSessions = 0;
+    std::uint64_t maxRssBytes = 0;
+    // Heap charged to all sessions (see Memory::SessionAccount)
+    std::int64_t maxSessionMemoryBytes = 0;
+    std::chrono::milliseconds maxQueueDelay{0};
+    // Admission resumes once every reading is below this share of its mark
+    double resumeRatio = 0.9;
+    Overflow overflow = Overflow::StaticPages;
+    std::chrono::milliseconds sampleInterval{100};
+};
+
+// Decides, before any Application is built, whether a new visitor gets a
+// session. Sessions, process RSS, session heap and the delay of the
+// server's event queue are compared against the policy; while any is over
+// its mark, visitors are sent to the pre-rendered pages or the queue page,
+// and existing sessions keep the server to themselves.
+class AdmissionController {
+public:
+    using Factory = std::function<std::unique_ptr<Wt::WApplication>(const Wt::WEnvironment&)>;
+    
+    explicit AdmissionController(AdmissionPolicy policy = AdmissionPolicy());
+    ~AdmissionController();
+    
+    AdmissionController(const AdmissionController&) = delete;
+    AdmissionController& operator=(const AdmissionController&) = delete;
+    
+    // Samples RSS, session heap and queue delay until stop()
+    void start(Wt::WServer& server);
+    void stop();
+    
+    // Where a visitor entering through AdmissionGate goes: the application,
+    // opened at internalPath, if admitted, otherwise a pre-rendered page or
+    // the queue page
+    std::string entryUrl(const std::string& internalPath = std::string());
+    
+    // Entry point for WServer::addEntryPoint: builds the application with
+    // factory if admitted. Visitors who skip the gate and are refused still
+    // get a short-lived application that only redirects them.
+    Factory wrap(Factory factory);
+    
+    bool overloaded() const { return overloaded_.load(std::memory_order_relaxed); }
+    std::size_t liveSessions() const { return liveSessions_->load(std::memory_order_relaxed); }
+    
+    // Gauges and counters in Prometheus text format
+    std::string renderPrometheus() const;
+    
+    const AdmissionPolicy& policy() const { return policy_; }
+    
+private:
+    class SessionTicket;
+    
+    bool admit();
+    bool overWatermark(double ratio) const;
+    std::string overflowUrl(const std::string& internalPath) const;
+    std::unique_ptr<Wt::WApplication> turnAway(const Wt::WEnvironment& env);
+    void sampleLoop(Wt::WServer* server);
+    
+    AdmissionPolicy policy_;
+    std::shared_ptr<std::atomic<std::size_t>> liveSessions_;
+    std::atomic<std::uint64_t> rssBytes_{0};
+    std::atomic<std::int64_t> sessionMemoryBytes_{0};
+    std::atomic<std::int64_t> queueDelayMicros_{0};
+    std::atomic<bool> overloaded_{false};
+    std::atomic<std::uint64_t> admitted_{0};
+    std::atomic<std::uint64_t> refused_{0};
+    std::atomic<std::uint64_t> refusedSessions_{0};
+    
+    std::thread sampler_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool running_ = false;
+};
+
+} // namespace App
+} // namespace CSPNet
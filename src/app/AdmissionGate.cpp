@@ -0,0 +1,34 @@
+#include "AdmissionGate.h"
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include "Routes.h"
+
+namespace CSPNet {
+namespace App {
+
+AdmissionGate::AdmissionGate(AdmissionController& admission) : admission_(admission) {
+}
+
+AdmissionGate::~AdmissionGate() {
+    beingDeleted();
+}
+
+void AdmissionGate::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) {
+    // ?path= opens the application on one of its routes; anything else is
+    // ignored rather than echoed into the redirect
+    std::string internalPath;
+    if (const std::string* path = request.getParameter("path")) {
+        RouteMatch<Route> match;
+        if (Routes::table.match(*path, match)) {
+            internalPath = *path;
+        }
+    }
+    
+    // Decided per visit; the answer must not be cached
+    response.setStatus(302);
+    response.addHeader("Location", admission_.entryUrl(internalPath));
+    response.addHeader("Cache-Control", "no-store");
+}
+
+} // namespace App
+} // namespace CSPNet
@@ -0,0 +1,23 @@
+#pragma once
+#include <Wt/WResource.h>
+#include "AdmissionController.h"
+
+namespace CSPNet {
+namespace App {
+
+// Plain resource in front of the application entry point. Visitors enter
+// through it and are redirected to the application only when admitted, so
+// a refused visitor costs one 302 and never a WebSession.
+class AdmissionGate : public Wt::WResource {
+public:
+    explicit AdmissionGate(AdmissionController& admission);
+    ~AdmissionGate() override;
+    
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+    
+private:
+    AdmissionController& admission_;
+};
+
+} // namespace App
+} // namespace CSPNet
@@ -1,25 +1,75 @@
 #include "Application.h"
 #include <Wt/WServer.h>
-#include <Wt/WVBoxLayout.h>
-#include <Wt/WHBoxLayout.h>
 #include <Wt/WText.h>
 #include <Wt/WPushButton.h>
 #include <Wt/WContainerWidget.h>
+#include <charconv>
 #include <iostream>
-#include "../styles/DesignSystem.h"
-#include "../styles/AppleTheme.h"
+#include "../styles/ThemeStyleSheet.h"
 #include "../builders/HomePageBuilder.h"
 #include "../builders/CreditsPageBuilder.h"
+#include "../components/Interactions.h"
+#include "../logging/Logger.h"
+#include "../metrics/Metrics.h"
+#include "../views/components/VirtualCreditsGrid.h"
+#include "Routes.h"
+#include "SetupPhase.h"
 
 namespace CSPNet {
 namespace App {
 
+namespace {
+
+// The whole of text as a number; false, leaving value alone, otherwise
+template <typename Number>
+bool parseNumber(const std::string& text, Number& value) {
+    Number parsed{};
+    const auto* end = text.data() + text.size();
+    const auto result = std::from_chars(text.data(), end, parsed);
+    if (result.ec != std::errc() || result.ptr != end) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+// Built from Routes::menu once; every session's navigation bar shares it
+std::shared_ptr<const Views::Components::NavigationMenu> navigationMenu() {
+    static const auto menu = []() {
+        std::vector<Views::Components::NavigationItem> items;
+        for (const auto& link : Routes::menu) {
+            items.push_back({ link.page, link.label, link.path });
+        }
+        return std::make_shared<const Views::Components::NavigationMenu>(std::move(items));
+    }();
+    return menu;
+}
+
+} // namespace
+
 Application::Application(const Wt::WEnvironment& env) 
-    : WApplication(env), mainLayout_(nullptr), homePage_(nullptr), creditsPage_(nullptr) {
+    : WApplication(env), overMemoryBudget_(false), mainLayout_(nullptr) {
+    Memory::SessionScope memoryScope(memory_);
+    memoryBudget_ = readMemoryBudget();
     setupApplication();
 }
 
+Application::~Application() {
+    // Coroutine actions cut short unwind here, before the controllers and
+    // widget tree they ran against are destroyed
+    if (tasks_) {
+        tasks_->cancel();
+    }
+}
+
+void Application::notify(const Wt::WEvent& event) {
+    Memory::SessionScope memoryScope(memory_);
+    WApplication::notify(event);
+    enforceMemoryBudget();
+}
+
 void Application::setupApplication() {
+    CSP_TIME_SCOPE("setup_application");
     setTitle("CSP-NET • Premium Platform");
     
     // Setup design system first
@@ -29,85 +79,190 @@ void Application::setupApplication() {
     setupControllers();
     
     // Create main layout with navigation callback
-    mainLayout_ = root()->addWidget(std::make_unique<Views::Layouts::MainLayout>());
-    
-    // Set up navigation callback
-    mainLayout_->setNavigationCallback([this](const std::string& page) {
-        handleNavigation(page);
-    });
+    setupMainLayout();
     
     // Setup routing
     setupRouting();
     
-    // Create and add pages
+    // Follow content changes, then create and add pages
+    setupContentUpdates();
     setupPages();
     
-    // Set initial route
-    navigateToHome();
+    // Open whatever page the URL points at
+    CSP_TIME_SCOPE("initial_route");
+    CSP_SETUP_PHASE("initial_route");
+    router_->start();
 }
 
 void Application::setupDesignSystem() {
-    // Setup core design system
-    Styles::DesignSystem::setupGlobalStyles();
-    Styles::DesignSystem::setupComponentStyles();
-    Styles::DesignSystem::setupLayoutStyles();
-    Styles::DesignSystem::setupResponsiveStyles();
-    
-    // Setup Apple theme
-    Styles::AppleTheme::setupAppleDesignSystem();
+    CSP_TIME_SCOPE("setup_design_system");
+    CSP_SETUP_PHASE("design_system");
+    // Design system + Apple theme, compiled at build time
+    useStyleSheet(Wt::WLink(std::string(Styles::ThemeStyleSheet::url())));
 }
 
 void Application::setupControllers() {
-    homeController_ = std::make_unique<Controllers::HomeController>();
-    creditsController_ = std::make_unique<Controllers::CreditsController>();
+    CSP_TIME_SCOPE("setup_controllers");
+    CSP_SETUP_PHASE("controllers");
+    tasks_ = std::make_unique<Tasks::SessionTasks>(sessionId());
+    homeController_ = std::make_unique<Controllers::HomeController>(*tasks_);
+    creditsController_ = std::make_unique<Controllers::CreditsController>(*tasks_);
+}
+
+void Application::setupMainLayout() {
+    CSP_TIME_SCOPE("setup_main_layout");
+    CSP_SETUP_PHASE("main_layout");
+    mainLayout_ = root()->addWidget(std::make_unique<Views::Layouts::MainLayout>(navigationMenu()));
+    
+    // Navigation links change the internal path; the router does the rest
+    mainLayout_->setNavigationCallback([this](const std::string& path) {
+        router_->navigate(path);
+    });
 }
 
 void Application::setupRouting() {
-    router_ = std::make_unique<Router>(mainLayout_->getContentStack());
+    CSP_TIME_SCOPE("setup_routing");
+    CSP_SETUP_PHASE("routing");
+    router_ = std::make_unique<Router>(this);
     
     // Add routes
-    router_->addRoute("home", [this]() { navigateToHome(); });
-    router_->addRoute("credits", [this]() { navigateToCredits(); });
+    router_->addRoute(Route::Home, [this](const Router::Match&) { showPage("home"); });
+    router_->addRoute(Route::Credits, [this](const Router::Match&) { showPage("credits"); });
+    router_->addRoute(Route::Credit, [this](const Router::Match& match) {
+        showCredit(static_cast<std::size_t>(match.params[0].number));
+    });
 }
 
 void Application::setupPages() {
-    auto contentStack = mainLayout_->getContentStack();
+    CSP_TIME_SCOPE("setup_pages");
+    CSP_SETUP_PHASE("pages");
+    pages_ = std::make_unique<PageRegistry>(mainLayout_->getContentStack(), readReleasePolicy());
     
-    // Clean Modular Architecture: Use specialized builders
-    homePage_ = Builders::HomePageBuilder::build(contentStack);
-    creditsPage_ = Builders::CreditsPageBuilder::build(contentStack);
+#ifdef CSP_NET_AUDIT_INTERACTIONS
+    // Flag visual effects that still round-trip to the server
+    pages_->setPageBuiltCallback([](const std::string&, Wt::WWidget* page) {
+        Components::Interactions::reportSignalBoundEffects(page);
+    });
+#endif
     
-    // Show home page by default
-    contentStack->setCurrentIndex(0);
+    // Clean Modular Architecture: pages are built by specialized builders on
+    // first navigation; registration order fixes the content stack indices
+    pages_->addPage("home", [this]() {
+        contentUpdates_->watch(ContentCollection::Features);
+        auto page = Builders::HomePageBuilder::create();
+        if (auto button = dynamic_cast<Wt::WPushButton*>(page->resolveWidget("get-started"))) {
+            button->clicked().connect([this]() { homeController_->handleGetStartedClick(); });
+        }
+        return page;
+    });
+    pages_->addPage("credits", [this]() {
+        contentUpdates_->watch(ContentCollection::Credits);
+        return Builders::CreditsPageBuilder::create();
+    });
 }
 
-void Application::navigateToHome() {
-    auto contentStack = mainLayout_->getContentStack();
-    contentStack->setCurrentIndex(0);
-    router_->setCurrentRoute("home");
+void Application::setupContentUpdates() {
+    CSP_TIME_SCOPE("setup_content_updates");
+    CSP_SETUP_PHASE("content_updates");
     
-    // Update navigation highlight
-    mainLayout_->getNavigation()->setActivePage("home");
+    // Changes arrive as posted events and are pushed, not polled for
+    enableUpdates(true);
+    contentUpdates_ = ContentUpdates::subscribe(sessionId(), [this](const ContentChange& change) {
+        onContentChanged(change);
+    });
 }
 
-void Application::navigateToCredits() {
-    auto contentStack = mainLayout_->getContentStack();
-    contentStack->setCurrentIndex(1);
-    router_->setCurrentRoute("credits");
+PageRegistry::ReleasePolicy Application::readReleasePolicy() const {
+    PageRegistry::ReleasePolicy policy;
+    std::string value;
     
-    // Update navigation highlight
-    mainLayout_->getNavigation()->setActivePage("credits");
+    // Optional <property> entries in wt_config.xml; a bad value keeps the
+    // default rather than failing every new session
+    if (readConfigurationProperty("csp-max-built-pages", value) && !parseNumber(value, policy.maxBuiltPages)) {
+        CSP_LOG_WARN("Config: csp-max-built-pages \"{}\" is not a count, using {}", value, policy.maxBuiltPages);
+    }
+    if (readConfigurationProperty("csp-page-idle-navigations", value) &&
+        !parseNumber(value, policy.idleNavigations)) {
+        CSP_LOG_WARN("Config: csp-page-idle-navigations \"{}\" is not a count, using {}", value,
+                     policy.idleNavigations);
+    }
+    return policy;
 }
 
-void Application::handleNavigation(const std::string& page) {
-    if (page == "home") {
-        navigateToHome();
-    } else if (page == "credits") {
-        navigateToCredits();
+Memory::SessionBudget Application::readMemoryBudget() const {
+    Memory::SessionBudget budget;
+    std::string value;
+    
+    // Optional <property> entries in wt_config.xml; a bad value keeps the
+    // default rather than failing every new session
+    if (readConfigurationProperty("csp-session-memory-budget", value) && !parseNumber(value, budget.maxBytes)) {
+        CSP_LOG_WARN("Config: csp-session-memory-budget \"{}\" is not a byte count, using {}", value,
+                     budget.maxBytes);
+    }
+    if (readConfigurationProperty("csp-session-memory-action", value) && value == "shed") {
+        budget.action = Memory::SessionBudget::Action::Shed;
     }
+    return budget;
 }
 
+void Application::enforceMemoryBudget() {
+    if (memoryBudget_.maxBytes <= 0 || memory_.liveBytes() <= memoryBudget_.maxBytes) {
+        overMemoryBudget_ = false;
+        return;
+    }
+    
+    // Pages not on screen are rebuilt on their next visit
+    if (memoryBudget_.action == Memory::SessionBudget::Action::Shed && pages_) {
+        const auto released = pages_->releaseInactivePages();
+        if (released > 0) {
+            CSP_LOG_INFO("Memory: session {} over budget, released {} pages", sessionId(), released);
+        }
+        if (memory_.liveBytes() <= memoryBudget_.maxBytes) {
+            overMemoryBudget_ = false;
+            return;
+        }
+    }
+    
+    // Warn once per excursion over the budget
+    if (!overMemoryBudget_) {
+        CSP_LOG_WARN("Memory: session {} holds {} bytes, budget is {}",
+                     sessionId(), memory_.liveBytes(), memoryBudget_.maxBytes);
+        overMemoryBudget_ = true;
+    }
+}
 
+Wt::WWidget* Application::showPage(const std::string& name) {
+    auto page = pages_->show(name);
+    
+    // Update navigation highlight
+    mainLayout_->getNavigation()->setActivePage(name);
+    return page;
+}
+
+void Application::showCredit(std::size_t index) {
+    auto page = showPage("credits");
+    if (auto grid = dynamic_cast<Views::Components::VirtualCreditsGrid*>(
+            page->find(Views::Components::VirtualCreditsGrid::widgetName))) {
+        grid->scrollToCredit(index);
+    }
+}
+
+void Application::onContentChanged(const ContentChange& change) {
+    CSP_TIME_SCOPE("content_update");
+    Memory::SessionScope memoryScope(memory_);
+    
+    // Pages not built yet, or released, are built from the new content anyway
+    if (change.features) {
+        if (auto home = dynamic_cast<Wt::WTemplate*>(pages_->builtPage("home"))) {
+            Builders::HomePageBuilder::refreshFeatures(home);
+        }
+    }
+    if (change.credits) {
+        if (auto credits = dynamic_cast<Wt::WTemplate*>(pages_->builtPage("credits"))) {
+            Builders::CreditsPageBuilder::refreshCredits(credits);
+        }
+    }
+}
 
 // Application factory function
 std::unique_ptr<Wt::WApplication> createApplication(const Wt::WEnvironment& env) {
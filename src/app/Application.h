@@ -1,10 +1,15 @@
 #pragma once
 #include <Wt/WApplication.h>
+#include <cstddef>
 #include <memory>
 #include "../views/layouts/MainLayout.h"
 #include "../controllers/HomeController.h"
 #include "../controllers/CreditsController.h"
+#include "../memory/AllocationTracker.h"
+#include "../tasks/SessionTasks.h"
+#include "ContentUpdates.h"
 #include "Router.h"
+#include "PageRegistry.h"
 
 namespace CSPNet {
 namespace App {
@@ -12,33 +17,55 @@ namespace App {
 class Application : public Wt::WApplication {
 public:
     explicit Application(const Wt::WEnvironment& env);
+    ~Application() override;
+    
+protected:
+    // Charges each event's allocations to this session, then checks its budget
+    void notify(const Wt::WEvent& event) override;
     
 private:
+    // Heap charged to this session; declared first so it outlives the
+    // other members' construction
+    Memory::SessionAccount memory_;
+    Memory::SessionBudget memoryBudget_;
+    bool overMemoryBudget_;
+    
     // Core components
     Views::Layouts::MainLayout* mainLayout_;
     std::unique_ptr<Router> router_;
     
+    // Controller work for this session; cancelled when the session ends
+    std::unique_ptr<Tasks::SessionTasks> tasks_;
+    
     // Controllers
     std::unique_ptr<Controllers::HomeController> homeController_;
     std::unique_ptr<Controllers::CreditsController> creditsController_;
     
-    // Pages
-    Wt::WContainerWidget* homePage_;
-    Wt::WContainerWidget* creditsPage_;
+    // Pages, built on first navigation
+    std::unique_ptr<PageRegistry> pages_;
+    
+    // Content changes for the built pages; declared after pages_ so it
+    // unsubscribes before they go
+    std::unique_ptr<ContentUpdates::Subscription> contentUpdates_;
     
     // Setup methods
     void setupApplication();
     void setupDesignSystem();
     void setupRouting();
     void setupControllers();
+    void setupMainLayout();
     void setupPages();
+    void setupContentUpdates();
+    PageRegistry::ReleasePolicy readReleasePolicy() const;
+    Memory::SessionBudget readMemoryBudget() const;
+    void enforceMemoryBudget();
     
-    // Navigation handlers
-    void navigateToHome();
-    void navigateToCredits();
-    void handleNavigation(const std::string& page);
+    // Route handlers
+    Wt::WWidget* showPage(const std::string& name);
+    void showCredit(std::size_t index);
     
-    // Clean Modular Architecture: Page creation handled by specialized builders
+    // Re-renders only the parts of built pages that show changed content
+    void onContentChanged(const ContentChange& change);
 };
 
 // Application factory function
@@ -0,0 +1,277 @@
+#include "ContentUpdates.h"
+#include <Wt/WApplication.h>
+#include <Wt/WServer.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../logging/Logger.h"
+#include "../metrics/Metrics.h"
+
+namespace CSPNet {
+namespace App {
+
+struct ContentUpdates::Subscriber {
+    std::string sessionId;
+    Listener listener;
+    std::atomic<unsigned> collections{0};
+    std::atomic<bool> subscribed{true};
+    
+    // Set while an event for this session waits in the server's queue
+    std::atomic<bool> queued{false};
+    
+    // Collection versions the session has been told about; session only
+    std::uint64_t featuresSeen = 0;
+    std::uint64_t creditsSeen = 0;
+    
+    // Position in Bus::subscribers, under Bus::mutex
+    std::size_t index = 0;
+};
+
+struct ContentUpdates::Bus {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Subscriber>> subscribers;
+    
+    // Newest publication not fanned out yet, and the content last fanned out
+    std::shared_ptr<const Models::ContentSnapshot> pending;
+    std::shared_ptr<const Models::ContentSnapshot> sent;
+    
+    // Bumped once per fan-out in which the collection really changed
+    std::atomic<std::uint64_t> featuresVersion{0};
+    std::atomic<std::uint64_t> creditsVersion{0};
+    
+    std::thread thread;
+    std::condition_variable wake;
+    std::chrono::milliseconds window{0};
+    bool running = false;
+    
+    std::atomic<std::uint64_t> publications{0};
+    std::atomic<std::uint64_t> fanOuts{0};
+    std::atomic<std::uint64_t> posted{0};
+    std::atomic<std::uint64_t> alreadyQueued{0};
+};
+
+ContentUpdates::Bus& ContentUpdates::bus() {
+    static Bus instance;
+    return instance;
+}
+
+ContentUpdates::Subscription::Subscription(std::shared_ptr<Subscriber> subscriber)
+    : subscriber_(std::move(subscriber)) {
+}
+
+ContentUpdates::Subscription::~Subscription() {
+    // An event still queued for the session sees this and does nothing
+    subscriber_->subscribed.store(false, std::memory_order_release);
+    
+    auto& b = bus();
+    std::lock_guard<std::mutex> lock(b.mutex);
+    const auto index = subscriber_->index;
+    b.subscribers[index] = std::move(b.subscribers.back());
+    b.subscribers[index]->index = index;
+    b.subscribers.pop_back();
+}
+
+void ContentUpdates::Subscription::watch(ContentCollection collection) {
+    subscriber_->collections.fetch_or(static_cast<unsigned>(collection), std::memory_order_relaxed);
+}
+
+void ContentUpdates::start(std::chrono::milliseconds window) {
+    auto& b = bus();
+    std::lock_guard<std::mutex> lock(b.mutex);
+    if (b.running) {
+        return;
+    }
+    b.window = window;
+    b.running = true;
+    
+    // Sessions start from whatever is live now
+    if (!b.sent) {
+        b.sent = Models::ContentSnapshot::current();
+    }
+    b.thread = std::thread(&ContentUpdates::flushLoop);
+    CSP_LOG_INFO("Content updates: coalescing window {} ms", window.count());
+}
+
+void ContentUpdates::stop() {
+    auto& b = bus();
+    {
+        std::lock_guard<std::mutex> lock(b.mutex);
+        if (!b.running) {
+            return;
+        }
+        b.running = false;
+    }
+    b.wake.notify_all();
+    b.thread.join();
+}
+
+void ContentUpdates::published(std::shared_ptr<const Models::ContentSnapshot> snapshot) {
+    auto& b = bus();
+    b.publications.fetch_add(1, std::memory_order_relaxed);
+    bool running;
+    {
+        std::lock_guard<std::mutex> lock(b.mutex);
+        b.pending = std::move(snapshot);
+        running = b.running;
+    }
+    if (running) {
+        b.wake.notify_all();
+    } else {
+        flush();
+    }
+}
+
+std::unique_ptr<ContentUpdates::Subscription> ContentUpdates::subscribe(const std::string& sessionId,
+                                                                        Listener listener) {
+    auto subscriber = std::make_shared<Subscriber>();
+    subscriber->sessionId = sessionId;
+    subscriber->listener = std::move(listener);
+    
+    // The session is built from current content; only later changes count
+    auto& b = bus();
+    subscriber->featuresSeen = b.featuresVersion.load(std::memory_order_acquire);
+    subscriber->creditsSeen = b.creditsVersion.load(std::memory_order_acquire);
+    
+    std::lock_guard<std::mutex> lock(b.mutex);
+    subscriber->index = b.subscribers.size();
+    b.subscribers.push_back(subscriber);
+    return std::unique_ptr<Subscription>(new Subscription(std::move(subscriber)));
+}
+
+void ContentUpdates::flushLoop() {
+    auto& b = bus();
+    std::unique_lock<std::mutex> lock(b.mutex);
+    while (b.running) {
+        b.wake.wait(lock, [&b]() { return b.pending || !b.running; });
+        if (!b.running) {
+            break;
+        }
+        
+        // Whatever else is published within the window goes out with it
+        b.wake.wait_for(lock, b.window, [&b]() { return !b.running; });
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+void ContentUpdates::flush() {
+    auto& b = bus();
+    std::shared_ptr<const Models::ContentSnapshot> snapshot;
+    std::shared_ptr<const Models::ContentSnapshot> previous;
+    {
+        std::lock_guard<std::mutex> lock(b.mutex);
+        snapshot = std::move(b.pending);
+        b.pending.reset();
+        if (!snapshot) {
+            return;
+        }
+        previous = b.sent;
+        b.sent = snapshot;
+    }
+    
+    // Compared once here rather than in every session
+    CSP_TIME_SCOPE("content_updates_fan_out");
+    const bool features = !previous || previous->features() != snapshot->features();
+    const bool credits = !previous || previous->credits() != snapshot->credits();
+    if (!features && !credits) {
+        return;
+    }
+    if (features) {
+        b.featuresVersion.fetch_add(1, std::memory_order_release);
+    }
+    if (credits) {
+        b.creditsVersion.fetch_add(1, std::memory_order_release);
+    }
+    b.fanOuts.fetch_add(1, std::memory_order_relaxed);
+    
+    auto server = Wt::WServer::instance();
+    if (!server) {
+        return;
+    }
+    const auto changed = (features ? static_cast<unsigned>(ContentCollection::Features) : 0u) |
+                         (credits ? static_cast<unsigned>(ContentCollection::Credits) : 0u);
+    
+    std::vector<std::shared_ptr<Subscriber>> targets;
+    {
+        std::lock_guard<std::mutex> lock(b.mutex);
+        targets.reserve(b.subscribers.size());
+        for (const auto& subscriber : b.subscribers) {
+            if (subscriber->collections.load(std::memory_order_relaxed) & changed) {
+                targets.push_back(subscriber);
+            }
+        }
+    }
+    
+    std::size_t posted = 0;
+    for (auto& subscriber : targets) {
+        if (subscriber->queued.exchange(true, std::memory_order_acq_rel)) {
+            b.alreadyQueued.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        server->post(subscriber->sessionId, [subscriber]() { deliver(subscriber); });
+        ++posted;
+    }
+    b.posted.fetch_add(posted, std::memory_order_relaxed);
+    CSP_LOG_DEBUG("Content updates: features {}, credits {}, {} sessions notified", features, credits, posted);
+}
+
+void ContentUpdates::deliver(const std::shared_ptr<Subscriber>& subscriber) {
+    // Cleared first, so a fan-out from here on posts again
+    subscriber->queued.store(false, std::memory_order_release);
+    if (!subscriber->subscribed.load(std::memory_order_acquire)) {
+        return;
+    }
+    
+    auto& b = bus();
+    const auto collections = subscriber->collections.load(std::memory_order_relaxed);
+    const auto featuresVersion = b.featuresVersion.load(std::memory_order_acquire);
+    const auto creditsVersion = b.creditsVersion.load(std::memory_order_acquire);
+    
+    ContentChange change;
+    change.features = (collections & static_cast<unsigned>(ContentCollection::Features)) &&
+                      subscriber->featuresSeen != featuresVersion;
+    change.credits = (collections & static_cast<unsigned>(ContentCollection::Credits)) &&
+                     subscriber->creditsSeen != creditsVersion;
+    subscriber->featuresSeen = featuresVersion;
+    subscriber->creditsSeen = creditsVersion;
+    if (!change.features && !change.credits) {
+        return;
+    }
+    
+    subscriber->listener(change);
+    if (auto app = Wt::WApplication::instance()) {
+        app->triggerUpdate();
+    }
+}
+
+std::string ContentUpdates::renderPrometheus() {
+    auto& b = bus();
+    std::size_t subscribers;
+    {
+        std::lock_guard<std::mutex> lock(b.mutex);
+        subscribers = b.subscribers.size();
+    }
+    
+    std::string out;
+    out += "# HELP csp_net_content_publications_total Content snapshots published.\n"
+           "# TYPE csp_net_content_publications_total counter\n"
+           "csp_net_content_publications_total " + std::to_string(b.publications.load()) + "\n"
+           "# HELP csp_net_content_fan_outs_total Coalesced content changes sent to sessions.\n"
+           "# TYPE csp_net_content_fan_outs_total counter\n"
+           "csp_net_content_fan_outs_total " + std::to_string(b.fanOuts.load()) + "\n"
+           "# HELP csp_net_content_session_events_total Content change events by outcome.\n"
+           "# TYPE csp_net_content_session_events_total counter\n"
+           "csp_net_content_session_events_total{outcome=\"posted\"} " + std::to_string(b.posted.load()) + "\n"
+           "csp_net_content_session_events_total{outcome=\"merged\"} " + std::to_string(b.alreadyQueued.load()) + "\n"
+           "# HELP csp_net_content_subscribers Sessions subscribed to content changes.\n"
+           "# TYPE csp_net_content_subscribers gauge\n"
+           "csp_net_content_subscribers " + std::to_string(subscribers) + "\n";
+    return out;
+}
+
+} // namespace App
+} // namespace CSPNet
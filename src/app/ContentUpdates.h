@@ -0,0 +1,78 @@
+#pragma once
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include "../models/ContentSnapshot.h"
+
+namespace CSPNet {
+namespace App {
+
+// Published collections a session can show
+enum class ContentCollection : unsigned {
+    Features = 1u << 0,
+    Credits = 1u << 1,
+};
+
+// What changed since a session last heard from ContentUpdates
+struct ContentChange {
+    bool features = false;
+    bool credits = false;
+};
+
+// Tells open sessions about newly published content. Publications within
+// one window are coalesced and compared with the last content sent out, once
+// for all sessions; only sessions watching a collection that really changed
+// get an event, through WServer::post. A session that has not run its last
+// event yet is not posted to again, and picks up everything when it runs.
+class ContentUpdates {
+    struct Subscriber;
+    struct Bus;
+    
+public:
+    using Listener = std::function<void(const ContentChange& change)>;
+    
+    // One session's interest; unsubscribes when destroyed. Create, use and
+    // destroy it on the session.
+    class Subscription {
+    public:
+        ~Subscription();
+        
+        Subscription(const Subscription&) = delete;
+        Subscription& operator=(const Subscription&) = delete;
+        
+        // Adds collection to the ones the listener hears about
+        void watch(ContentCollection collection);
+    
+    private:
+        friend class ContentUpdates;
+        
+        explicit Subscription(std::shared_ptr<Subscriber> subscriber);
+        
+        std::shared_ptr<Subscriber> subscriber_;
+    };
+    
+    // Fans out at most once per window until stop()
+    static void start(std::chrono::milliseconds window);
+    static void stop();
+    
+    // Called after snapshot was published, from any thread. Before start()
+    // and after stop(), fans out at once on the calling thread.
+    static void published(std::shared_ptr<const Models::ContentSnapshot> snapshot);
+    
+    // listener runs on the session, which has server push enabled and gets
+    // the resulting changes pushed
+    static std::unique_ptr<Subscription> subscribe(const std::string& sessionId, Listener listener);
+    
+    // Counters in Prometheus text format
+    static std::string renderPrometheus();
+    
+private:
+    static Bus& bus();
+    static void flushLoop();
+    static void flush();
+    static void deliver(const std::shared_ptr<Subscriber>& subscriber);
+};
+
+} // namespace App
+} // namespace CSPNet
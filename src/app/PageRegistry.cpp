@@ -0,0 +1,136 @@
+#include "PageRegistry.h"
+#include <Wt/WContainerWidget.h>
+#include "../memory/AllocationTracker.h"
+
+namespace CSPNet {
+namespace App {
+
+PageRegistry::PageRegistry(Wt::WStackedWidget* contentStack, ReleasePolicy policy)
+    : contentStack_(contentStack), policy_(policy), navigations_(0), current_(-1) {
+}
+
+int PageRegistry::addPage(const std::string& name, PageFactory factory) {
+    // An empty placeholder reserves the index until the page is first shown
+    auto placeholder = contentStack_->addWidget(std::make_unique<Wt::WContainerWidget>());
+    entries_.push_back({ name, std::move(factory), placeholder, false, 0 });
+    return static_cast<int>(entries_.size()) - 1;
+}
+
+Wt::WWidget* PageRegistry::show(const std::string& name) {
+    return show(indexOf(name));
+}
+
+Wt::WWidget* PageRegistry::show(int index) {
+    if (index < 0 || index >= static_cast<int>(entries_.size())) {
+        return nullptr;
+    }
+    
+    auto& entry = entries_[index];
+    if (!entry.built) {
+        build(index);
+    }
+    
+    entry.lastShown = ++navigations_;
+    current_ = index;
+    contentStack_->setCurrentIndex(index);
+    
+    applyPolicy();
+    return entry.widget;
+}
+
+int PageRegistry::indexOf(const std::string& name) const {
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+        if (entries_[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool PageRegistry::isBuilt(int index) const {
+    return index >= 0 && index < static_cast<int>(entries_.size()) && entries_[index].built;
+}
+
+Wt::WWidget* PageRegistry::builtPage(const std::string& name) const {
+    const auto index = indexOf(name);
+    return isBuilt(index) ? entries_[index].widget : nullptr;
+}
+
+std::size_t PageRegistry::builtCount() const {
+    std::size_t count = 0;
+    for (const auto& entry : entries_) {
+        count += entry.built ? 1 : 0;
+    }
+    return count;
+}
+
+std::size_t PageRegistry::releaseInactivePages() {
+    std::size_t released = 0;
+    for (int i = 0; i < static_cast<int>(entries_.size()); ++i) {
+        if (i != current_ && entries_[i].built) {
+            release(i);
+            ++released;
+        }
+    }
+    return released;
+}
+
+void PageRegistry::replace(int index, std::unique_ptr<Wt::WWidget> widget) {
+    auto& entry = entries_[index];
+    contentStack_->removeWidget(entry.widget);
+    entry.widget = contentStack_->insertWidget(index, std::move(widget));
+    
+    // Removing a widget shifts the stack's current index
+    if (current_ >= 0) {
+        contentStack_->setCurrentIndex(current_);
+    }
+}
+
+void PageRegistry::build(int index) {
+    auto& entry = entries_[index];
+    {
+        Memory::TagScope allocations(Memory::AllocationTag::get(Memory::AllocationTag::Page, entry.name));
+        replace(index, entry.factory());
+    }
+    entry.built = true;
+    
+    if (pageBuilt_) {
+        pageBuilt_(entry.name, entry.widget);
+    }
+}
+
+void PageRegistry::release(int index) {
+    replace(index, std::make_unique<Wt::WContainerWidget>());
+    entries_[index].built = false;
+}
+
+void PageRegistry::applyPolicy() {
+    // Idle pages first, then least recently shown until under the limit
+    if (policy_.idleNavigations > 0) {
+        for (int i = 0; i < static_cast<int>(entries_.size()); ++i) {
+            const auto& entry = entries_[i];
+            if (i != current_ && entry.built && navigations_ - entry.lastShown >= policy_.idleNavigations) {
+                release(i);
+            }
+        }
+    }
+    
+    if (policy_.maxBuiltPages > 0) {
+        while (builtCount() > policy_.maxBuiltPages) {
+            int oldest = -1;
+            for (int i = 0; i < static_cast<int>(entries_.size()); ++i) {
+                if (i != current_ && entries_[i].built &&
+                    (oldest < 0 || entries_[i].lastShown < entries_[oldest].lastShown)) {
+                    oldest = i;
+                }
+            }
+            if (oldest < 0) {
+                break;
+            }
+            release(oldest);
+        }
+    }
+}
+
+} // namespace App
+} // namespace CSPNet
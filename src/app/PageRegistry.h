@@ -0,0 +1,73 @@
+#pragma once
+#include <Wt/WStackedWidget.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CSPNet {
+namespace App {
+
+// When PageRegistry hands built pages back to placeholders
+struct PageReleasePolicy {
+    // Keep at most this many pages built (0 = no limit)
+    std::size_t maxBuiltPages = 0;
+    // Release a page not shown for this many navigations (0 = never)
+    unsigned idleNavigations = 0;
+};
+
+// Builds pages on first navigation and can release rarely used ones back
+// to an empty placeholder. Every page keeps the content stack index it was
+// registered with, whether it is built or not.
+class PageRegistry {
+public:
+    using PageFactory = std::function<std::unique_ptr<Wt::WWidget>()>;
+    using PageCallback = std::function<void(const std::string& name, Wt::WWidget* page)>;
+    using ReleasePolicy = PageReleasePolicy;
+    
+    explicit PageRegistry(Wt::WStackedWidget* contentStack, ReleasePolicy policy = ReleasePolicy());
+    
+    int addPage(const std::string& name, PageFactory factory);
+    
+    // Builds the page if needed and makes it current; nullptr for unknown names
+    Wt::WWidget* show(const std::string& name);
+    Wt::WWidget* show(int index);
+    
+    int indexOf(const std::string& name) const;
+    bool isBuilt(int index) const;
+    
+    // The page if it is built, nullptr otherwise; never builds it
+    Wt::WWidget* builtPage(const std::string& name) const;
+    std::size_t builtCount() const;
+    
+    // Drops every built page except the current one, e.g. under memory pressure
+    std::size_t releaseInactivePages();
+    
+    void setReleasePolicy(ReleasePolicy policy) { policy_ = policy; }
+    void setPageBuiltCallback(PageCallback callback) { pageBuilt_ = std::move(callback); }
+    
+private:
+    struct Entry {
+        std::string name;
+        PageFactory factory;
+        Wt::WWidget* widget;
+        bool built;
+        unsigned lastShown;
+    };
+    
+    Wt::WStackedWidget* contentStack_;
+    ReleasePolicy policy_;
+    PageCallback pageBuilt_;
+    std::vector<Entry> entries_;
+    unsigned navigations_;
+    int current_;
+    
+    void replace(int index, std::unique_ptr<Wt::WWidget> widget);
+    void build(int index);
+    void release(int index);
+    void applyPolicy();
+};
+
+} // namespace App
+} // namespace CSPNet
@@ -0,0 +1,230 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "../utils/ContentHash.h"
+
+namespace CSPNet {
+namespace App {
+
+constexpr std::size_t maxRouteSegments = 8;
+constexpr std::size_t maxRouteParams = 4;
+
+// How a ":name" segment is validated and converted when a path is matched
+enum class ParamType : std::uint8_t {
+    Text,       // any non-empty segment
+    Unsigned    // decimal digits, available as number
+};
+
+// One route: an id, a pattern such as "/credits/:id" and the types of its
+// parameters in order (Text when omitted)
+template <typename Id>
+struct RouteSpec {
+    Id id;
+    std::string_view pattern;
+    std::array<ParamType, maxRouteParams> params = {};
+};
+
+struct RouteParam {
+    std::string_view text;
+    std::uint64_t number = 0;
+};
+
+// Result of a successful match; text views point into the matched path
+template <typename Id>
+struct RouteMatch {
+    Id id = {};
+    std::size_t index = 0;
+    std::array<RouteParam, maxRouteParams> params = {};
+    std::size_t paramCount = 0;
+};
+
+// Non-empty segments of a path; "/" has none and trailing slashes are ignored
+struct PathSegments {
+    std::array<std::string_view, maxRouteSegments> items = {};
+    std::size_t count = 0;
+    bool overflow = false;
+};
+
+constexpr PathSegments splitPath(std::string_view path) {
+    PathSegments segments;
+    std::size_t pos = 0;
+    while (pos < path.size()) {
+        if (path[pos] == '/') {
+            ++pos;
+            continue;
+        }
+        auto end = path.find('/', pos);
+        if (end == std::string_view::npos) {
+            end = path.size();
+        }
+        if (segments.count == maxRouteSegments) {
+            segments.overflow = true;
+            break;
+        }
+        segments.items[segments.count++] = path.substr(pos, end - pos);
+        pos = end;
+    }
+    return segments;
+}
+
+constexpr bool parseUnsigned(std::string_view text, std::uint64_t& value) {
+    if (text.empty() || text.size() > 19) {
+        return false;
+    }
+    value = 0;
+    for (char c : text) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        value = value * 10 + static_cast<std::uint64_t>(c - '0');
+    }
+    return true;
+}
+
+// Routes are keyed on their first segment and segment count, so the key of
+// an incoming path is known before any parameter is parsed
+constexpr std::uint64_t routeKey(std::string_view first, std::size_t count, std::uint64_t seed) {
+    auto key = Utils::contentHash(first) + count * 0x9e3779b97f4a7c15ULL;
+    key ^= seed;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return key;
+}
+
+// Route table with a perfect hash computed at compile time. Lookup splits
+// the path into views, probes exactly one slot and checks that one pattern;
+// nothing is allocated.
+template <typename Id, std::size_t N>
+class RouteTable {
+public:
+    static constexpr std::size_t slotCount = [] {
+        std::size_t slots = 1;
+        while (slots < 2 * N) {
+            slots *= 2;
+        }
+        return slots;
+    }();
+    
+    constexpr explicit RouteTable(const RouteSpec<Id> (&routes)[N]) {
+        for (std::size_t i = 0; i < N; ++i) {
+            routes_[i] = routes[i];
+            patterns_[i] = splitPath(routes[i].pattern);
+        }
+        for (std::uint64_t seed = 1; seed <= 4096 && !valid_; ++seed) {
+            valid_ = tryBuild(seed);
+        }
+        valid_ = valid_ && patternsValid();
+    }
+    
+    // False when two patterns share a first segment and segment count, a
+    // pattern starts with a parameter or has too many segments/parameters
+    constexpr bool valid() const { return valid_; }
+    
+    constexpr std::size_t size() const { return N; }
+    constexpr const RouteSpec<Id>& operator[](std::size_t index) const { return routes_[index]; }
+    
+    constexpr std::size_t indexOf(Id id) const {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (routes_[i].id == id) {
+                return i;
+            }
+        }
+        return N;
+    }
+    
+    constexpr bool match(std::string_view path, RouteMatch<Id>& result) const {
+        const auto segments = splitPath(path);
+        if (segments.overflow) {
+            return false;
+        }
+        const auto slot = slots_[slotOf(segments, seed_)];
+        if (slot == 0) {
+            return false;
+        }
+        
+        const auto index = static_cast<std::size_t>(slot - 1);
+        const auto& pattern = patterns_[index];
+        if (pattern.count != segments.count) {
+            return false;
+        }
+        
+        RouteMatch<Id> match;
+        match.id = routes_[index].id;
+        match.index = index;
+        for (std::size_t i = 0; i < pattern.count; ++i) {
+            const auto expected = pattern.items[i];
+            const auto actual = segments.items[i];
+            if (!isParam(expected)) {
+                if (expected != actual) {
+                    return false;
+                }
+                continue;
+            }
+            RouteParam param;
+            param.text = actual;
+            if (routes_[index].params[match.paramCount] == ParamType::Unsigned &&
+                !parseUnsigned(actual, param.number)) {
+                return false;
+            }
+            match.params[match.paramCount++] = param;
+        }
+        result = match;
+        return true;
+    }
+    
+private:
+    static constexpr bool isParam(std::string_view segment) {
+        return !segment.empty() && segment[0] == ':';
+    }
+    
+    static constexpr std::size_t slotOf(const PathSegments& segments, std::uint64_t seed) {
+        const auto first = segments.count > 0 ? segments.items[0] : std::string_view();
+        return static_cast<std::size_t>(routeKey(first, segments.count, seed) & (slotCount - 1));
+    }
+    
+    constexpr bool tryBuild(std::uint64_t seed) {
+        for (auto& slot : slots_) {
+            slot = 0;
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            auto& slot = slots_[slotOf(patterns_[i], seed)];
+            if (slot != 0) {
+                return false;
+            }
+            slot = static_cast<std::uint8_t>(i + 1);
+        }
+        seed_ = seed;
+        return true;
+    }
+    
+    constexpr bool patternsValid() const {
+        if (N >= 255) {
+            return false;
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            const auto& pattern = patterns_[i];
+            if (pattern.overflow || (pattern.count > 0 && isParam(pattern.items[0]))) {
+                return false;
+            }
+            std::size_t params = 0;
+            for (std::size_t j = 0; j < pattern.count; ++j) {
+                params += isParam(pattern.items[j]) ? 1 : 0;
+            }
+            if (params > maxRouteParams) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    std::array<RouteSpec<Id>, N> routes_ = {};
+    std::array<PathSegments, N> patterns_ = {};
+    std::array<std::uint8_t, slotCount> slots_ = {};
+    std::uint64_t seed_ = 0;
+    bool valid_ = false;
+};
+
+} // namespace App
+} // namespace CSPNet
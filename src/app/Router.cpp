@@ -1,30 +1,43 @@
 #include "Router.h"
-#include <iostream>
+#include "../logging/Logger.h"
+#include "../metrics/Metrics.h"
 
 namespace CSPNet {
 namespace App {
 
-Router::Router(Wt::WStackedWidget* contentStack) : contentStack_(contentStack), currentRoute_("home") {
+Router::Router(Wt::WApplication* app) : app_(app), currentRoute_(Route::Home) {
 }
 
-void Router::addRoute(const std::string& path, std::function<void()> handler) {
-    routes_[path] = handler;
+void Router::addRoute(Route route, Handler handler) {
+    handlers_[Routes::table.indexOf(route)] = std::move(handler);
+}
+
+void Router::start() {
+    app_->internalPathChanged().connect([this](const std::string& path) {
+        dispatch(path);
+    });
+    dispatch(app_->internalPath());
 }
 
 void Router::navigate(const std::string& path) {
-    auto it = routes_.find(path);
-    if (it != routes_.end()) {
-        currentRoute_ = path;
-        it->second();
-        std::cout << "Navigated to: " << path << std::endl;
-    } else {
-        std::cout << "Route not found: " << path << std::endl;
-    }
+    app_->setInternalPath(path, true);
 }
 
-void Router::setCurrentRoute(const std::string& path) {
-    currentRoute_ = path;
+void Router::dispatch(const std::string& path) {
+    CSP_TIME_SCOPE("router_navigate");
+    Match match;
+    if (!Routes::table.match(path, match) || !handlers_[match.index]) {
+        CSP_LOG_INFO("Route not found: {}", path);
+        if (path != Routes::homePath) {
+            navigate(Routes::homePath);
+        }
+        return;
+    }
+    
+    currentRoute_ = match.id;
+    handlers_[match.index](match);
+    CSP_LOG_DEBUG("Navigated to: {}", path);
 }
 
 } // namespace App
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
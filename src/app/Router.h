@@ -1,26 +1,41 @@
 #pragma once
 #include <string>
 #include <functional>
-#include <unordered_map>
-#include <Wt/WStackedWidget.h>
+#include <array>
+#include <Wt/WApplication.h>
+#include "Routes.h"
 
 namespace CSPNet {
 namespace App {
 
+// Maps Wt internal paths onto the compile-time route table. Every
+// navigation, whether from a click, the address bar or history, changes the
+// internal path and is dispatched from internalPathChanged.
 class Router {
 public:
-    Router(Wt::WStackedWidget* contentStack);
+    using Match = RouteMatch<Route>;
+    using Handler = std::function<void(const Match&)>;
     
-    void addRoute(const std::string& path, std::function<void()> handler);
+    explicit Router(Wt::WApplication* app);
+    
+    void addRoute(Route route, Handler handler);
+    
+    // Connects to internal path changes and dispatches the current path, so
+    // a bookmarked URL opens its own page directly
+    void start();
+    
+    // Changes the internal path; the route is dispatched through the signal
     void navigate(const std::string& path);
-    void setCurrentRoute(const std::string& path);
-    std::string getCurrentRoute() const { return currentRoute_; }
+    
+    Route getCurrentRoute() const { return currentRoute_; }
     
 private:
-    Wt::WStackedWidget* contentStack_;
-    std::unordered_map<std::string, std::function<void()>> routes_;
-    std::string currentRoute_;
+    void dispatch(const std::string& path);
+    
+    Wt::WApplication* app_;
+    std::array<Handler, Routes::table.size()> handlers_;
+    Route currentRoute_;
 };
 
 } // namespace App
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
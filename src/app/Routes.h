@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <iterator>
+#include "RouteTable.h"
+
+namespace CSPNet {
+namespace App {
+
+enum class Route : std::uint8_t {
+    Home,
+    Credits,
+    Credit
+};
+
+// Internal paths of the application, relative to its entry point
+class Routes {
+public:
+    static constexpr const char* homePath = "/";
+    static constexpr const char* creditsPath = "/credits";
+    
+    static constexpr RouteSpec<Route> specs[] = {
+        { Route::Home, "/" },
+        { Route::Credits, "/credits" },
+        { Route::Credit, "/credits/:id", { ParamType::Unsigned } },
+    };
+    
+    static constexpr RouteTable<Route, std::size(specs)> table{specs};
+    static_assert(table.valid(), "Route patterns must be unique by first segment and segment count");
+    
+    // Pages linked from the navigation bar, in menu order; page is the
+    // PageRegistry name
+    struct MenuLink {
+        const char* page;
+        const char* label;
+        const char* path;
+    };
+    
+    static constexpr MenuLink menu[] = {
+        { "home", "Home", homePath },
+        { "credits", "Credits", creditsPath },
+    };
+};
+
+} // namespace App
+} // namespace CSPNet
@@ -0,0 +1,56 @@
+#pragma once
+#include "../metrics/Metrics.h"
+
+namespace CSPNet {
+namespace App {
+
+// Observes the phases of Application construction. Only benchmark builds
+// (CSP_NET_BENCH) report phases; elsewhere CSP_SETUP_PHASE expands to
+// nothing and no probe is ever called.
+class SetupPhaseProbe {
+public:
+    virtual ~SetupPhaseProbe() = default;
+    
+    virtual void begin(const char* phase) = 0;
+    virtual void end(const char* phase) = 0;
+    
+    // Probe for the calling thread; nullptr when none is installed
+    static SetupPhaseProbe*& current() {
+        thread_local SetupPhaseProbe* probe = nullptr;
+        return probe;
+    }
+};
+
+// Reports the enclosing scope as one phase to the installed probe
+class SetupPhaseScope {
+public:
+    explicit SetupPhaseScope(const char* phase)
+        : phase_(phase), probe_(SetupPhaseProbe::current()) {
+        if (probe_) {
+            probe_->begin(phase_);
+        }
+    }
+    
+    ~SetupPhaseScope() {
+        if (probe_) {
+            probe_->end(phase_);
+        }
+    }
+    
+    SetupPhaseScope(const SetupPhaseScope&) = delete;
+    SetupPhaseScope& operator=(const SetupPhaseScope&) = delete;
+    
+private:
+    const char* phase_;
+    SetupPhaseProbe* probe_;
+};
+
+} // namespace App
+} // namespace CSPNet
+
+#ifdef CSP_NET_BENCH
+#define CSP_SETUP_PHASE(phase) \
+    ::CSPNet::App::SetupPhaseScope CSP_METRICS_CONCAT(cspSetupPhase_, __LINE__)(phase)
+#else
+#define CSP_SETUP_PHASE(phase) ((void)0)
+#endif
@@ -0,0 +1,205 @@
+#include "AssetPipeline.h"
+#include <sys/stat.h>
+#include <fstream>
+#include "Compression.h"
+#include "../logging/Logger.h"
+#include "../styles/StyleSheetCompiler.h"
+#include "../utils/ContentHash.h"
+#include "../utils/Json.h"
+
+namespace CSPNet {
+namespace Assets {
+
+namespace {
+
+struct FileType {
+    const char* extension;
+    const char* mimeType;
+    bool compressible;
+};
+
+const FileType fileTypes[] = {
+    { ".css",  "text/css; charset=utf-8",               true },
+    { ".js",   "application/javascript; charset=utf-8", true },
+    { ".html", "text/html; charset=utf-8",              true },
+};
+
+std::string extensionOf(const std::string& path) {
+    auto slash = path.find_last_of('/');
+    auto dot = path.find_last_of('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return "";
+    }
+    return path.substr(dot);
+}
+
+const FileType* fileTypeOf(const std::string& path) {
+    auto extension = extensionOf(path);
+    for (const auto& type : fileTypes) {
+        if (extension == type.extension) {
+            return &type;
+        }
+    }
+    return nullptr;
+}
+
+std::string stripCssComments(std::string_view css) {
+    std::string stripped;
+    stripped.reserve(css.size());
+    for (std::size_t i = 0; i < css.size(); ++i) {
+        if (css[i] == '/' && i + 1 < css.size() && css[i + 1] == '*') {
+            auto end = css.find("*/", i + 2);
+            if (end == std::string_view::npos) {
+                break;
+            }
+            i = end + 1;
+            continue;
+        }
+        stripped += css[i];
+    }
+    return stripped;
+}
+
+std::string minifyCss(std::string_view css) {
+    const auto stripped = stripCssComments(css);
+    auto emit = [&stripped](Styles::CssWriter& out) {
+        Styles::CssMinifier minifier(out);
+        minifier.append(stripped);
+    };
+    
+    std::string minified(Styles::measure(emit), '\0');
+    Styles::CssWriter writer(&minified[0]);
+    emit(writer);
+    return minified;
+}
+
+// Only CSS is minified. JavaScript is passed through unchanged: a safe JS
+// minifier needs a real tokenizer, and gzip already removes most redundancy.
+std::string minifyAsset(const std::string& logicalPath, std::string_view content) {
+    if (extensionOf(logicalPath) == ".css") {
+        return minifyCss(content);
+    }
+    return std::string(content);
+}
+
+std::string hashedUrl(const std::string& logicalPath, const std::string& hash) {
+    auto slash = logicalPath.find_last_of('/');
+    auto directory = logicalPath.substr(0, slash + 1);
+    auto fileName = logicalPath.substr(slash + 1);
+    auto extension = extensionOf(fileName);
+    auto stem = fileName.substr(0, fileName.size() - extension.size());
+    return "/assets" + directory + stem + "-" + hash + extension;
+}
+
+void makeDirectories(const std::string& path) {
+    for (std::size_t pos = path.find('/', 1); ; pos = path.find('/', pos + 1)) {
+        mkdir(path.substr(0, pos).c_str(), 0755);
+        if (pos == std::string::npos) {
+            break;
+        }
+    }
+}
+
+} // namespace
+
+AssetManifest::AssetManifest(std::vector<Asset> assets) : assets_(std::move(assets)) {
+    for (std::size_t i = 0; i < assets_.size(); ++i) {
+        byLogicalPath_[assets_[i].logicalPath] = i;
+    }
+}
+
+const Asset* AssetManifest::find(const std::string& logicalPath) const {
+    auto it = byLogicalPath_.find(logicalPath);
+    return it != byLogicalPath_.end() ? &assets_[it->second] : nullptr;
+}
+
+std::string AssetManifest::url(const std::string& logicalPath) const {
+    auto asset = find(logicalPath);
+    return asset ? asset->url : logicalPath;
+}
+
+std::string AssetManifest::toJson() const {
+    std::string json = "{\n";
+    for (std::size_t i = 0; i < assets_.size(); ++i) {
+        const auto& asset = assets_[i];
+        json += "  ";
+        Utils::appendJsonString(json, asset.logicalPath);
+        json += ": { \"url\": ";
+        Utils::appendJsonString(json, asset.url);
+        json += ", \"etag\": ";
+        Utils::appendJsonString(json, asset.etag);
+        json += ", \"bytes\": " + std::to_string(asset.body.size());
+        json += ", \"gzipBytes\": " + std::to_string(asset.gzipBody.size());
+        json += i + 1 < assets_.size() ? " },\n" : " }\n";
+    }
+    json += "}\n";
+    return json;
+}
+
+AssetPipeline::AssetPipeline(std::string outputDir) : outputDir_(std::move(outputDir)) {
+}
+
+void AssetPipeline::addGenerated(const std::string& logicalPath, std::string_view content) {
+    sources_.push_back({ logicalPath, std::string(content) });
+}
+
+std::shared_ptr<const AssetManifest> AssetPipeline::build() const {
+    std::vector<Asset> assets;
+    assets.reserve(sources_.size());
+    
+    for (const auto& source : sources_) {
+        auto asset = compile(source.logicalPath, source.content, false);
+        writeOutput(asset);
+        assets.push_back(std::move(asset));
+    }
+    
+    auto manifest = std::make_shared<const AssetManifest>(std::move(assets));
+    writeFile("/assets/manifest.json", manifest->toJson());
+    return manifest;
+}
+
+Asset AssetPipeline::compile(const std::string& logicalPath, std::string_view content, bool minify) {
+    const auto* type = fileTypeOf(logicalPath);
+    
+    Asset asset;
+    asset.logicalPath = logicalPath;
+    asset.mimeType = type ? type->mimeType : "application/octet-stream";
+    asset.body = minify ? minifyAsset(logicalPath, content) : std::string(content);
+    
+    const auto hash = Utils::toHex(Utils::contentHash(asset.body));
+    asset.url = hashedUrl(logicalPath, hash);
+    asset.etag = "\"" + hash + "\"";
+    
+    if (type && type->compressible) {
+        auto compressed = gzipCompress(asset.body);
+        if (compressed.size() < asset.body.size()) {
+            asset.gzipBody = std::move(compressed);
+            asset.gzipEtag = "\"" + hash + ".gz\"";
+        }
+    }
+    return asset;
+}
+
+void AssetPipeline::writeOutput(const Asset& asset) const {
+    writeFile(asset.url, asset.body);
+    if (!asset.gzipBody.empty()) {
+        writeFile(asset.url + ".gz", asset.gzipBody);
+    }
+}
+
+void AssetPipeline::writeFile(const std::string& url, const std::string& bytes) const {
+    if (outputDir_.empty()) {
+        return;
+    }
+    
+    auto path = outputDir_ + url;
+    makeDirectories(path.substr(0, path.find_last_of('/')));
+    
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.write(bytes.data(), bytes.size())) {
+        CSP_LOG_ERROR("Asset pipeline: could not write {}", path);
+    }
+}
+
+} // namespace Assets
+} // namespace CSPNet
@@ -0,0 +1,70 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CSPNet {
+namespace Assets {
+
+// One static file after minification, hashing and compression
+struct Asset {
+    std::string logicalPath;   // e.g. "/theme.css"
+    std::string url;           // content-hashed, e.g. "/assets/theme-<hash>.css"
+    std::string mimeType;
+    std::string etag;          // strong ETag of the identity bytes
+    std::string gzipEtag;      // strong ETag of the gzip bytes
+    std::string body;
+    std::string gzipBody;      // empty when compression does not pay off
+};
+
+// Immutable result of a pipeline run, shared by all asset resources
+class AssetManifest {
+public:
+    explicit AssetManifest(std::vector<Asset> assets);
+    
+    const std::vector<Asset>& assets() const { return assets_; }
+    const Asset* find(const std::string& logicalPath) const;
+    
+    // Hashed URL for a logical path, or the path itself when unknown
+    std::string url(const std::string& logicalPath) const;
+    std::string toJson() const;
+    
+private:
+    std::vector<Asset> assets_;
+    std::unordered_map<std::string, std::size_t> byLogicalPath_;
+};
+
+// Content-hashes and gzips generated CSS/JS once at startup. Results are
+// also written to outputDir so a front proxy can serve the precompressed
+// files directly. Docroot files are left to Wt: nothing links them by a
+// hashed URL, so hashed copies would never be requested.
+class AssetPipeline {
+public:
+    explicit AssetPipeline(std::string outputDir);
+    
+    // Generated content is served as given: it is already minified, and
+    // its producer may have hashed it (see ThemeStyleSheet::url())
+    void addGenerated(const std::string& logicalPath, std::string_view content);
+    std::shared_ptr<const AssetManifest> build() const;
+    
+    // Minifies (unless told not to), hashes and compresses a single file
+    // without writing it
+    static Asset compile(const std::string& logicalPath, std::string_view content, bool minify = true);
+    
+private:
+    struct Source {
+        std::string logicalPath;
+        std::string content;
+    };
+    
+    std::string outputDir_;
+    std::vector<Source> sources_;
+    
+    void writeOutput(const Asset& asset) const;
+    void writeFile(const std::string& url, const std::string& bytes) const;
+};
+
+} // namespace Assets
+} // namespace CSPNet
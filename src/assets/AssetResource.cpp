@@ -0,0 +1,55 @@
+#include "AssetResource.h"
+#include <atomic>
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include "../utils/HttpCaching.h"
+
+namespace CSPNet {
+namespace Assets {
+
+AssetResource::AssetResource(std::shared_ptr<const AssetManifest> manifest, const Asset& asset,
+                             std::string cacheControl)
+    : manifest_(std::move(manifest)), logicalPath_(asset.logicalPath), cacheControl_(std::move(cacheControl)) {
+}
+
+AssetResource::~AssetResource() {
+    beingDeleted();
+}
+
+void AssetResource::update(std::shared_ptr<const AssetManifest> manifest) {
+    std::atomic_store(&manifest_, std::move(manifest));
+}
+
+void AssetResource::handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) {
+    const auto manifest = std::atomic_load(&manifest_);
+    const auto* asset = manifest->find(logicalPath_);
+    if (!asset) {
+        response.setStatus(404);
+        return;
+    }
+    
+    const bool gzip = !asset->gzipBody.empty() && Utils::acceptsGzip(request.headerValue("Accept-Encoding"));
+    const auto& etag = gzip ? asset->gzipEtag : asset->etag;
+    
+    response.addHeader("Cache-Control", cacheControl_);
+    response.addHeader("ETag", etag);
+    if (!asset->gzipBody.empty()) {
+        response.addHeader("Vary", "Accept-Encoding");
+    }
+    
+    if (Utils::etagMatches(request.headerValue("If-None-Match"), etag)) {
+        response.setStatus(304);
+        return;
+    }
+    
+    const auto& body = gzip ? asset->gzipBody : asset->body;
+    response.setMimeType(asset->mimeType);
+    if (gzip) {
+        response.addHeader("Content-Encoding", "gzip");
+    }
+    response.setContentLength(body.size());
+    response.out().write(body.data(), body.size());
+}
+
+} // namespace Assets
+} // namespace CSPNet
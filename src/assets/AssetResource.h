@@ -0,0 +1,36 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <Wt/WResource.h>
+#include "AssetPipeline.h"
+
+namespace CSPNet {
+namespace Assets {
+
+// Serves one precompressed asset: gzip bytes when the client accepts them,
+// strong ETags per encoding and 304 for matching If-None-Match.
+class AssetResource : public Wt::WResource {
+public:
+    // Content-hashed URLs never change, so they never need revalidation
+    static constexpr const char* immutable = "public, max-age=31536000, immutable";
+    // Fixed URLs (e.g. pre-rendered pages) are revalidated with the ETag
+    static constexpr const char* revalidate = "no-cache";
+    
+    AssetResource(std::shared_ptr<const AssetManifest> manifest, const Asset& asset,
+                  std::string cacheControl = immutable);
+    ~AssetResource() override;
+    
+    // Atomically switches to the same logical path in a newer manifest;
+    // requests in flight finish with the manifest they started with
+    void update(std::shared_ptr<const AssetManifest> manifest);
+    
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+    
+private:
+    std::shared_ptr<const AssetManifest> manifest_;
+    std::string logicalPath_;
+    std::string cacheControl_;
+};
+
+} // namespace Assets
+} // namespace CSPNet
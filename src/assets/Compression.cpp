@@ -0,0 +1,32 @@
+#include "Compression.h"
+#include <stdexcept>
+
+namespace CSPNet {
+namespace Assets {
+
+std::string gzipCompress(std::string_view data, int level) {
+    z_stream stream{};
+    
+    // windowBits + 16 selects the gzip wrapper instead of raw zlib
+    if (deflateInit2(&stream, level, Z_DEFLATED, MAX_WBITS + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error("gzip: deflateInit2 failed");
+    }
+    
+    std::string compressed(deflateBound(&stream, data.size()), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    
+    int result = deflate(&stream, Z_FINISH);
+    deflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+        throw std::runtime_error("gzip: deflate did not finish");
+    }
+    
+    compressed.resize(stream.total_out);
+    return compressed;
+}
+
+} // namespace Assets
+} // namespace CSPNet
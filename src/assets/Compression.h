@@ -0,0 +1,13 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <zlib.h>
+
+namespace CSPNet {
+namespace Assets {
+
+// Compresses data into a complete gzip member (header + deflate + trailer)
+std::string gzipCompress(std::string_view data, int level = Z_BEST_COMPRESSION);
+
+} // namespace Assets
+} // namespace CSPNet
@@ -1,92 +1,65 @@
 #include "CreditsPageBuilder.h"
-#include "../components/ComponentFactory.h"
+#include "../metrics/Metrics.h"
+#include "../views/components/VirtualCreditsGrid.h"
+#include "../styles/InlineStyles.h"
 #include <memory>
 
 namespace CSPNet {
 namespace Builders {
 
-Wt::WContainerWidget* CreditsPageBuilder::build(Wt::WStackedWidget* contentStack) {
-    auto creditsPage = createPageContainer(contentStack);
-    auto layout = setupPageLayout(creditsPage);
-    
-    // Build page sections in logical order
-    buildHeroSection(layout);
-    buildCreditsGridSection(layout);
+Wt::WTemplate* CreditsPageBuilder::build(Wt::WStackedWidget* contentStack) {
+    return contentStack->addWidget(create());
+}
+
+std::unique_ptr<Wt::WTemplate> CreditsPageBuilder::create() {
+    CSP_TIME_SCOPE("credits_page_build");
+    auto creditsPage = std::make_unique<Views::Components::SharedTemplate>(skeleton());
+    creditsPage->setStyleClass(Styles::InlineStyles::pageBackground.className());
     
+    // Only the visible window of credits is ever materialized
+    creditsPage->bindWidget("credits-grid", std::make_unique<Views::Components::VirtualCreditsGrid>());
     return creditsPage;
 }
 
-Wt::WContainerWidget* CreditsPageBuilder::createPageContainer(Wt::WStackedWidget* contentStack) {
-    auto creditsPage = contentStack->addWidget(std::make_unique<Wt::WContainerWidget>());
-    creditsPage->setAttributeValue("style", 
-        "min-height: calc(100vh - 52px); "
-        "padding: 80px 20px; "
-        "overflow: visible; "
-        "background: linear-gradient(135deg, #000000 0%, #1d1d1f 50%, #000000 100%);"
-    );
-    return creditsPage;
+std::shared_ptr<const Views::Components::PageTemplate> CreditsPageBuilder::skeleton() {
+    static Views::Components::TemplateCache cache(&CreditsPageBuilder::renderSkeleton);
+    return cache.get();
 }
 
-Wt::WVBoxLayout* CreditsPageBuilder::setupPageLayout(Wt::WContainerWidget* page) {
-    auto container = page->addWidget(std::make_unique<Wt::WContainerWidget>());
-    container->setAttributeValue("style", 
-        "max-width: 1200px; "
-        "margin: 0 auto; "
-        "text-align: center; "
-        "overflow: visible;"
-    );
-    
-    auto layout = container->setLayout(std::make_unique<Wt::WVBoxLayout>());
-    layout->setContentsMargins(0, 0, 0, 0);
-    return layout;
+void CreditsPageBuilder::refreshCredits(Wt::WTemplate* page) {
+    if (auto grid = dynamic_cast<Views::Components::VirtualCreditsGrid*>(page->resolveWidget("credits-grid"))) {
+        grid->rebind();
+    }
 }
 
-void CreditsPageBuilder::buildHeroSection(Wt::WVBoxLayout* layout) {
-    auto hero = layout->addWidget(std::make_unique<Wt::WContainerWidget>());
-    hero->setAttributeValue("style", "margin-bottom: 80px;");
+std::string CreditsPageBuilder::renderSkeleton(const Models::ContentSnapshot&) {
+    CSP_TIME_SCOPE("credits_template_render");
+    std::string xhtml = "<div class=\"";
+    xhtml += Styles::InlineStyles::pageContent.className();
+    xhtml += "\">";
     
-    auto heroLayout = hero->setLayout(std::make_unique<Wt::WVBoxLayout>());
-    heroLayout->setContentsMargins(0, 0, 0, 0);
+    // Render page sections in logical order
+    renderHeroSection(xhtml);
+    renderCreditsGridSection(xhtml);
     
-    auto title = heroLayout->addWidget(std::make_unique<Wt::WText>("Credits"));
-    title->setAttributeValue("style", 
-        "font-size: clamp(48px, 8vw, 96px); "
-        "font-weight: 700; "
-        "letter-spacing: -0.055em; "
-        "margin-bottom: 24px; "
-        "background: linear-gradient(135deg, #ffffff 0%, #f5f5f7 25%, #d1d1d6 75%, #a1a1a6 100%); "
-        "-webkit-background-clip: text; "
-        "-webkit-text-fill-color: transparent; "
-        "background-clip: text; "
-        "line-height: 1.05; "
-        "font-family: -apple-system, BlinkMacSystemFont, system-ui, sans-serif;"
-    );
-    
-    auto subtitle = heroLayout->addWidget(std::make_unique<Wt::WText>("Built with passion by"));
-    subtitle->setAttributeValue("style", 
-        "font-size: clamp(21px, 3vw, 28px); "
-        "font-weight: 400; "
-        "color: rgba(245, 245, 247, 0.7); "
-        "margin-bottom: 48px; "
-        "letter-spacing: -0.022em; "
-        "line-height: 1.14; "
-        "font-family: -apple-system, BlinkMacSystemFont, system-ui, sans-serif;"
-    );
+    xhtml += "</div>";
+    return xhtml;
 }
 
-void CreditsPageBuilder::buildCreditsGridSection(Wt::WVBoxLayout* layout) {
-    auto credits = layout->addWidget(std::make_unique<Wt::WContainerWidget>());
-    credits->setStyleClass("credits-grid");
-    
-    // Create credit cards using ComponentFactory
-    Components::ComponentFactory::createCreditCard(credits, 
-        "Zerohexer", 
-        "Project Creator & Developer");
-    
-    Components::ComponentFactory::createCreditCard(credits, 
-        "Claude Code", 
-        "AI Development Assistant");
+void CreditsPageBuilder::renderHeroSection(std::string& xhtml) {
+    xhtml += "<div class=\"";
+    xhtml += Styles::InlineStyles::heroSpacing.className();
+    xhtml += "\"><span class=\"";
+    xhtml += Styles::InlineStyles::heroTitle.className();
+    xhtml += "\">Credits</span><span class=\"";
+    xhtml += Styles::InlineStyles::heroSubtitle.className();
+    xhtml += "\">Built with passion by</span></div>";
+}
+
+void CreditsPageBuilder::renderCreditsGridSection(std::string& xhtml) {
+    // The grid pages through the credits itself
+    xhtml += "${credits-grid}";
 }
 
 } // namespace Builders
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
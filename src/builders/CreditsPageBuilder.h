@@ -1,26 +1,32 @@
 #pragma once
-#include <Wt/WContainerWidget.h>
 #include <Wt/WStackedWidget.h>
-#include <Wt/WVBoxLayout.h>
-#include <Wt/WText.h>
+#include <Wt/WTemplate.h>
+#include <memory>
+#include <string>
+#include "../models/ContentSnapshot.h"
+#include "../views/components/SharedTemplate.h"
 
 namespace CSPNet {
 namespace Builders {
 
 class CreditsPageBuilder {
 public:
-    // Main builder method
-    static Wt::WContainerWidget* build(Wt::WStackedWidget* contentStack);
+    // Main builder methods
+    static Wt::WTemplate* build(Wt::WStackedWidget* contentStack);
+    static std::unique_ptr<Wt::WTemplate> create();
     
-private:
-    // Section builders
-    static void buildHeroSection(Wt::WVBoxLayout* layout);
-    static void buildCreditsGridSection(Wt::WVBoxLayout* layout);
+    // Shared skeleton; binds ${credits-grid}
+    static std::shared_ptr<const Views::Components::PageTemplate> skeleton();
+    
+    // Rebinds a built page's visible credits to the current content
+    static void refreshCredits(Wt::WTemplate* page);
     
-    // Helper methods
-    static Wt::WContainerWidget* createPageContainer(Wt::WStackedWidget* contentStack);
-    static Wt::WVBoxLayout* setupPageLayout(Wt::WContainerWidget* page);
+private:
+    // Section renderers, run once per published content
+    static std::string renderSkeleton(const Models::ContentSnapshot& content);
+    static void renderHeroSection(std::string& xhtml);
+    static void renderCreditsGridSection(std::string& xhtml);
 };
 
 } // namespace Builders
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
@@ -1,103 +1,95 @@
 #include "HomePageBuilder.h"
 #include "../components/ComponentFactory.h"
+#include "../metrics/Metrics.h"
+#include "../styles/InlineStyles.h"
 #include <memory>
 
 namespace CSPNet {
 namespace Builders {
 
-Wt::WContainerWidget* HomePageBuilder::build(Wt::WStackedWidget* contentStack) {
-    auto homePage = createPageContainer(contentStack);
-    auto layout = setupPageLayout(homePage);
-    
-    // Build page sections in logical order
-    buildHeroSection(layout);
-    buildFeaturesSection(layout);
-    buildCtaSection(layout);
+using Views::Components::PageTemplate;
+
+Wt::WTemplate* HomePageBuilder::build(Wt::WStackedWidget* contentStack) {
+    return contentStack->addWidget(create());
+}
+
+std::unique_ptr<Wt::WTemplate> HomePageBuilder::create() {
+    CSP_TIME_SCOPE("home_page_build");
+    auto homePage = std::make_unique<Views::Components::SharedTemplate>(skeleton());
+    homePage->setStyleClass(Styles::InlineStyles::pageBackground.className());
     
+    // The only per-session parts of the page
+    auto features = std::make_unique<Views::Components::SharedTemplate>(featuresSkeleton());
+    features->setStyleClass("features");
+    homePage->bindWidget("features", std::move(features));
+    homePage->bindWidget("get-started", Components::ComponentFactory::makeGetStartedButton());
     return homePage;
 }
 
-Wt::WContainerWidget* HomePageBuilder::createPageContainer(Wt::WStackedWidget* contentStack) {
-    auto homePage = contentStack->addWidget(std::make_unique<Wt::WContainerWidget>());
-    homePage->setAttributeValue("style", 
-        "min-height: calc(100vh - 52px); "
-        "padding: 80px 20px; "
-        "overflow: visible; "
-        "background: linear-gradient(135deg, #000000 0%, #1d1d1f 50%, #000000 100%);"
-    );
-    return homePage;
+std::shared_ptr<const PageTemplate> HomePageBuilder::skeleton() {
+    static Views::Components::TemplateCache cache(&HomePageBuilder::renderSkeleton);
+    return cache.get();
 }
 
-Wt::WVBoxLayout* HomePageBuilder::setupPageLayout(Wt::WContainerWidget* page) {
-    auto container = page->addWidget(std::make_unique<Wt::WContainerWidget>());
-    container->setAttributeValue("style", 
-        "max-width: 1200px; "
-        "margin: 0 auto; "
-        "text-align: center; "
-        "overflow: visible;"
-    );
-    
-    auto layout = container->setLayout(std::make_unique<Wt::WVBoxLayout>());
-    layout->setContentsMargins(0, 0, 0, 0);
-    return layout;
+std::shared_ptr<const PageTemplate> HomePageBuilder::featuresSkeleton() {
+    static Views::Components::TemplateCache cache(&HomePageBuilder::renderFeatures);
+    return cache.get();
 }
 
-void HomePageBuilder::buildHeroSection(Wt::WVBoxLayout* layout) {
-    auto hero = layout->addWidget(std::make_unique<Wt::WContainerWidget>());
-    hero->setAttributeValue("style", "margin-bottom: 80px;");
-    
-    auto heroLayout = hero->setLayout(std::make_unique<Wt::WVBoxLayout>());
-    heroLayout->setContentsMargins(0, 0, 0, 0);
-    
-    auto title = heroLayout->addWidget(std::make_unique<Wt::WText>("CSP-NET"));
-    title->setAttributeValue("style", 
-        "font-size: clamp(48px, 8vw, 96px); "
-        "font-weight: 700; "
-        "letter-spacing: -0.055em; "
-        "margin-bottom: 24px; "
-        "background: linear-gradient(135deg, #ffffff 0%, #f5f5f7 25%, #d1d1d6 75%, #a1a1a6 100%); "
-        "-webkit-background-clip: text; "
-        "-webkit-text-fill-color: transparent; "
-        "background-clip: text; "
-        "line-height: 1.05; "
-        "font-family: -apple-system, BlinkMacSystemFont, system-ui, sans-serif;"
-    );
-    
-    auto subtitle = heroLayout->addWidget(std::make_unique<Wt::WText>("Premium Web Platform"));
-    subtitle->setAttributeValue("style", 
-        "font-size: clamp(21px, 3vw, 28px); "
-        "font-weight: 400; "
-        "color: rgba(245, 245, 247, 0.7); "
-        "margin-bottom: 48px; "
-        "letter-spacing: -0.022em; "
-        "line-height: 1.14; "
-        "font-family: -apple-system, BlinkMacSystemFont, system-ui, sans-serif;"
-    );
+void HomePageBuilder::refreshFeatures(Wt::WTemplate* page) {
+    if (auto features = dynamic_cast<Views::Components::SharedTemplate*>(page->resolveWidget("features"))) {
+        features->setSkeleton(featuresSkeleton());
+    }
 }
 
-void HomePageBuilder::buildFeaturesSection(Wt::WVBoxLayout* layout) {
-    auto features = layout->addWidget(std::make_unique<Wt::WContainerWidget>());
-    features->setStyleClass("features");
+std::string HomePageBuilder::renderSkeleton(const Models::ContentSnapshot&) {
+    CSP_TIME_SCOPE("home_template_render");
+    std::string xhtml = "<div class=\"";
+    xhtml += Styles::InlineStyles::pageContent.className();
+    xhtml += "\">";
     
-    // Create feature cards using ComponentFactory
-    Components::ComponentFactory::createFeatureCard(features, 
-        "Modern Architecture", 
-        "Built with Drogon C++ framework for high-performance backend operations");
+    // Render page sections in logical order
+    renderHeroSection(xhtml);
+    renderFeaturesSection(xhtml);
+    renderCtaSection(xhtml);
     
-    Components::ComponentFactory::createFeatureCard(features, 
-        "Premium UI", 
-        "Wt Framework components with Apple-inspired design system and interactions");
+    xhtml += "</div>";
+    return xhtml;
+}
+
+void HomePageBuilder::renderHeroSection(std::string& xhtml) {
+    xhtml += "<div class=\"";
+    xhtml += Styles::InlineStyles::heroSpacing.className();
+    xhtml += "\"><span class=\"";
+    xhtml += Styles::InlineStyles::heroTitle.className();
+    xhtml += "\">CSP-NET</span><span class=\"";
+    xhtml += Styles::InlineStyles::heroSubtitle.className();
+    xhtml += "\">Premium Web Platform</span></div>";
+}
+
+void HomePageBuilder::renderFeaturesSection(std::string& xhtml) {
+    // The features template is the .features grid itself
+    xhtml += "${features}";
+}
+
+std::string HomePageBuilder::renderFeatures(const Models::ContentSnapshot& content) {
+    CSP_TIME_SCOPE("home_features_render");
     
-    Components::ComponentFactory::createFeatureCard(features, 
-        "Enterprise Ready", 
-        "Scalable, secure, and production-ready platform from day one");
+    // Same markup as Components::ComponentFactory::createFeatureCard
+    std::string xhtml;
+    for (const auto& feature : content.features()) {
+        xhtml += "<div class=\"feature-card\"><span class=\"feature-title\">";
+        PageTemplate::appendText(xhtml, feature.title);
+        xhtml += "</span><span class=\"feature-desc\">";
+        PageTemplate::appendText(xhtml, feature.description);
+        xhtml += "</span></div>";
+    }
+    return xhtml;
 }
 
-void HomePageBuilder::buildCtaSection(Wt::WVBoxLayout* layout) {
-    // Create Get Started button using ComponentFactory
-    auto container = layout->addWidget(std::make_unique<Wt::WContainerWidget>());
-    Components::ComponentFactory::createGetStartedButton(container);
+void HomePageBuilder::renderCtaSection(std::string& xhtml) {
+    xhtml += "<div class=\"cta-section\">${get-started}</div>";
 }
 
 } // namespace Builders
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
@@ -1,27 +1,39 @@
 #pragma once
-#include <Wt/WContainerWidget.h>
 #include <Wt/WStackedWidget.h>
-#include <Wt/WVBoxLayout.h>
-#include <Wt/WText.h>
+#include <Wt/WTemplate.h>
+#include <memory>
+#include <string>
+#include "../models/ContentSnapshot.h"
+#include "../views/components/SharedTemplate.h"
 
 namespace CSPNet {
 namespace Builders {
 
 class HomePageBuilder {
 public:
-    // Main builder method
-    static Wt::WContainerWidget* build(Wt::WStackedWidget* contentStack);
+    // Main builder methods
+    static Wt::WTemplate* build(Wt::WStackedWidget* contentStack);
+    static std::unique_ptr<Wt::WTemplate> create();
     
-private:
-    // Section builders
-    static void buildHeroSection(Wt::WVBoxLayout* layout);
-    static void buildFeaturesSection(Wt::WVBoxLayout* layout);
-    static void buildCtaSection(Wt::WVBoxLayout* layout);
+    // Shared skeleton for the current content; binds ${features} and
+    // ${get-started}
+    static std::shared_ptr<const Views::Components::PageTemplate> skeleton();
+    
+    // Shared feature cards, bound to ${features} as their own template so
+    // new features re-render only that section
+    static std::shared_ptr<const Views::Components::PageTemplate> featuresSkeleton();
     
-    // Helper methods
-    static Wt::WContainerWidget* createPageContainer(Wt::WStackedWidget* contentStack);
-    static Wt::WVBoxLayout* setupPageLayout(Wt::WContainerWidget* page);
+    // Switches a built page to the current features
+    static void refreshFeatures(Wt::WTemplate* page);
+    
+private:
+    // Section renderers, run once per published content
+    static std::string renderSkeleton(const Models::ContentSnapshot& content);
+    static std::string renderFeatures(const Models::ContentSnapshot& content);
+    static void renderHeroSection(std::string& xhtml);
+    static void renderFeaturesSection(std::string& xhtml);
+    static void renderCtaSection(std::string& xhtml);
 };
 
 } // namespace Builders
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
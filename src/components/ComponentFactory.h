@@ -1,8 +1,8 @@
 #pragma once
 #include <Wt/WContainerWidget.h>
-#include <Wt/WVBoxLayout.h>
 #include <Wt/WText.h>
 #include <Wt/WPushButton.h>
+#include <memory>
 #include <string>
 
 namespace CSPNet {
@@ -21,11 +21,10 @@ public:
                                const std::string& role);
     
     // Interactive Buttons
+    static constexpr const char* getStartedButtonName = "get-started";
     static Wt::WPushButton* createGetStartedButton(Wt::WContainerWidget* parent);
-    
-private:
-    // Helper methods for button interactions
-    static void setupGetStartedButtonHover(Wt::WPushButton* button);
+    // Unparented, for binding into a template's .cta-section
+    static std::unique_ptr<Wt::WPushButton> makeGetStartedButton();
 };
 
 } // namespace Components
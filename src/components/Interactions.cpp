@@ -0,0 +1,56 @@
+#include "Interactions.h"
+#include <Wt/WFormWidget.h>
+#include <typeinfo>
+#include "../logging/Logger.h"
+
+namespace CSPNet {
+namespace Components {
+
+namespace {
+
+bool hasSignalBoundEffect(Wt::WWidget* widget) {
+    if (auto interactive = dynamic_cast<Wt::WInteractWidget*>(widget)) {
+        if (interactive->mouseWentOver().isConnected() || interactive->mouseWentOut().isConnected()) {
+            return true;
+        }
+    }
+    if (auto form = dynamic_cast<Wt::WFormWidget*>(widget)) {
+        if (form->focussed().isConnected() || form->blurred().isConnected()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void collectSignalBoundEffects(Wt::WWidget* widget, std::vector<Wt::WWidget*>& found) {
+    if (hasSignalBoundEffect(widget)) {
+        found.push_back(widget);
+    }
+    for (auto child : widget->children()) {
+        collectSignalBoundEffects(child, found);
+    }
+}
+
+} // namespace
+
+void Interactions::addEffect(Wt::WWidget* widget, const char* effectClass) {
+    widget->addStyleClass(effectClass);
+}
+
+std::vector<Wt::WWidget*> Interactions::findSignalBoundEffects(Wt::WWidget* root) {
+    std::vector<Wt::WWidget*> found;
+    if (root) {
+        collectSignalBoundEffects(root, found);
+    }
+    return found;
+}
+
+void Interactions::reportSignalBoundEffects(Wt::WWidget* root) {
+    for (auto widget : findSignalBoundEffects(root)) {
+        CSP_LOG_WARN("Interaction audit: {} #{} binds hover/focus to a server signal; "
+                     "use a theme state class instead", typeid(*widget).name(), widget->id());
+    }
+}
+
+} // namespace Components
+} // namespace CSPNet
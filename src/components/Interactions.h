@@ -0,0 +1,29 @@
+#pragma once
+#include <Wt/WWidget.h>
+#include <vector>
+
+namespace CSPNet {
+namespace Components {
+
+// Purely visual interactions (hover, focus) are resolved in the browser by
+// the theme's :hover/:focus rules and never round-trip to the server.
+class Interactions {
+public:
+    // Style classes whose interaction states are defined in the theme
+    static constexpr const char* ctaButton = "cta-button";
+    static constexpr const char* featureCard = "feature-card";
+    static constexpr const char* creditCard = "credit-card";
+    static constexpr const char* navItem = "nav-item";
+    
+    // Attaches a client-side effect by giving the widget its state class
+    static void addEffect(Wt::WWidget* widget, const char* effectClass);
+    
+    // Widgets below root that still connect hover/focus signals. Any
+    // connection counts, since an exposed signal makes the browser report
+    // every occurrence of the event.
+    static std::vector<Wt::WWidget*> findSignalBoundEffects(Wt::WWidget* root);
+    static void reportSignalBoundEffects(Wt::WWidget* root);
+};
+
+} // namespace Components
+} // namespace CSPNet
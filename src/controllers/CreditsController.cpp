@@ -1,10 +1,11 @@
 #include "CreditsController.h"
-#include <iostream>
+#include "../logging/Logger.h"
+#include "../metrics/Metrics.h"
 
 namespace CSPNet {
 namespace Controllers {
 
-CreditsController::CreditsController() {
+CreditsController::CreditsController(Tasks::SessionTasks& tasks) : tasks_(tasks) {
     setupController();
 }
 
@@ -23,8 +24,16 @@ Wt::WContainerWidget* CreditsController::createPageContent(Wt::WStackedWidget* c
 }
 
 void CreditsController::handleCreditInteraction(const std::string& creditId) {
-    std::cout << "Credit interaction: " << creditId << std::endl;
-    // Handle credit card interactions
+    CSP_LOG_INFO("Credit interaction: {}", creditId);
+    static auto& timer = Metrics::Registry::timer("credits_credit_interaction");
+    const Metrics::Stopwatch stopwatch(timer);
+    tasks_.run(
+        [creditId]() {
+            // Handle credit card interactions
+        },
+        [stopwatch]() {
+            stopwatch.record();
+        });
 }
 
 } // namespace Controllers
@@ -3,13 +3,15 @@
 #include <Wt/WContainerWidget.h>
 #include <Wt/WStackedWidget.h>
 #include "../views/pages/CreditsPage.h"
+#include "../tasks/SessionTasks.h"
 
 namespace CSPNet {
 namespace Controllers {
 
 class CreditsController {
 public:
-    CreditsController();
+    // Handler work runs through the session's tasks, off the event thread
+    explicit CreditsController(Tasks::SessionTasks& tasks);
     
     std::unique_ptr<Views::Pages::CreditsPage> createView();
     Wt::WContainerWidget* createPageContent(Wt::WStackedWidget* contentStack);
@@ -17,6 +19,8 @@ public:
     
 private:
     void setupController();
+    
+    Tasks::SessionTasks& tasks_;
 };
 
 } // namespace Controllers
@@ -1,10 +1,14 @@
 #include "HomeController.h"
-#include <iostream>
+#include "../logging/Logger.h"
+#include "../metrics/Metrics.h"
+#ifdef CSP_NET_COROUTINES
+#include "../api/ApiClient.h"
+#endif
 
 namespace CSPNet {
 namespace Controllers {
 
-HomeController::HomeController() {
+HomeController::HomeController(Tasks::SessionTasks& tasks) : tasks_(tasks) {
     setupController();
 }
 
@@ -23,13 +27,58 @@ Wt::WContainerWidget* HomeController::createPageContent(Wt::WStackedWidget* cont
 }
 
 void HomeController::handleGetStartedClick() {
-    std::cout << "Get Started button clicked!" << std::endl;
-    // Handle button logic here - could navigate, show modal, etc.
+    CSP_LOG_INFO("Get Started button clicked");
+    
+    // Timed from the click until the result is back on the session
+    static auto& timer = Metrics::Registry::timer("home_get_started_click");
+    const Metrics::Stopwatch stopwatch(timer);
+    
+#ifdef CSP_NET_COROUTINES
+    getStarted(stopwatch);
+#else
+    // The completion is back on the session and may update widgets
+    tasks_.run(
+        []() {
+            // Signup writes and data fetches go here, off the event thread
+        },
+        [stopwatch]() {
+            stopwatch.record();
+            CSP_LOG_DEBUG("Get Started handled");
+        });
+#endif
 }
 
+#ifdef CSP_NET_COROUTINES
+// Each co_await releases the session; the code between them runs on it
+Tasks::Action HomeController::getStarted(Metrics::Stopwatch stopwatch) {
+    auto features = co_await Tasks::callback<Api::ApiResponse>(tasks_, [](auto resolve) {
+        Api::ApiClient::get("/api/features", std::move(resolve));
+    });
+    if (!features.ok) {
+        stopwatch.record();
+        CSP_LOG_WARN("Get Started: feature fetch failed with status {}", features.status);
+        co_return;
+    }
+    
+    co_await Tasks::offload(tasks_, []() {
+        // Signup writes go here
+    });
+    stopwatch.record();
+    CSP_LOG_DEBUG("Get Started handled");
+}
+#endif
+
 void HomeController::handleFeatureInteraction(const std::string& featureId) {
-    std::cout << "Feature interaction: " << featureId << std::endl;
-    // Handle feature card interactions
+    CSP_LOG_INFO("Feature interaction: {}", featureId);
+    static auto& timer = Metrics::Registry::timer("home_feature_interaction");
+    const Metrics::Stopwatch stopwatch(timer);
+    tasks_.run(
+        [featureId]() {
+            // Handle feature card interactions
+        },
+        [stopwatch]() {
+            stopwatch.record();
+        });
 }
 
 } // namespace Controllers
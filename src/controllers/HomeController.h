@@ -3,13 +3,19 @@
 #include <Wt/WContainerWidget.h>
 #include <Wt/WStackedWidget.h>
 #include "../views/pages/HomePage.h"
+#include "../tasks/SessionTasks.h"
+#ifdef CSP_NET_COROUTINES
+#include "../metrics/Metrics.h"
+#include "../tasks/Async.h"
+#endif
 
 namespace CSPNet {
 namespace Controllers {
 
 class HomeController {
 public:
-    HomeController();
+    // Handler work runs through the session's tasks, off the event thread
+    explicit HomeController(Tasks::SessionTasks& tasks);
     
     std::unique_ptr<Views::Pages::HomePage> createView();
     Wt::WContainerWidget* createPageContent(Wt::WStackedWidget* contentStack);
@@ -18,6 +24,12 @@ public:
     
 private:
     void setupController();
+    
+#ifdef CSP_NET_COROUTINES
+    Tasks::Action getStarted(Metrics::Stopwatch stopwatch);
+#endif
+    
+    Tasks::SessionTasks& tasks_;
 };
 
 } // namespace Controllers
@@ -0,0 +1,283 @@
+#include "Logger.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace CSPNet {
+namespace Logging {
+
+namespace {
+
+// Single-producer/single-consumer queue owned by one logging thread
+class Ring {
+public:
+    static constexpr std::size_t capacity = 256;
+    
+    Record* claim() {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == capacity) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return &records_[tail % capacity];
+    }
+    
+    void commit() {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    
+    const Record* front() const {
+        const auto head = head_.load(std::memory_order_relaxed);
+        return head == tail_.load(std::memory_order_acquire) ? nullptr : &records_[head % capacity];
+    }
+    
+    void pop() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    
+    std::uint64_t takeDropped() { return dropped_.exchange(0, std::memory_order_relaxed); }
+    
+    void close() { closed_.store(true, std::memory_order_release); }
+    bool closed() const { return closed_.load(std::memory_order_acquire); }
+    
+private:
+    std::array<Record, capacity> records_;
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<bool> closed_{false};
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+    std::thread writer;
+    std::atomic<bool> running{false};
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+// Registers a ring on a thread's first log call and retires it on exit
+struct ThreadRing {
+    std::shared_ptr<Ring> ring;
+    
+    ThreadRing() : ring(std::make_shared<Ring>()) {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.rings.push_back(ring);
+    }
+    
+    ~ThreadRing() {
+        ring->close();
+    }
+};
+
+Ring& threadRing() {
+    thread_local ThreadRing local;
+    return *local.ring;
+}
+
+const char* levelName(Level level) {
+    switch (level) {
+        case Level::Debug: return "DEBUG";
+        case Level::Info:  return "INFO ";
+        case Level::Warn:  return "WARN ";
+        case Level::Error: return "ERROR";
+        default:           return "     ";
+    }
+}
+
+void appendTimestamp(std::string& out, std::uint64_t nanoseconds) {
+    const auto seconds = static_cast<std::time_t>(nanoseconds / 1000000000ULL);
+    const auto millis = static_cast<unsigned>((nanoseconds / 1000000ULL) % 1000);
+    std::tm utc;
+    gmtime_r(&seconds, &utc);
+    
+    char buffer[32];
+    const auto length = std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:%02d.%03uZ ",
+                                      utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday,
+                                      utc.tm_hour, utc.tm_min, utc.tm_sec, millis);
+    out.append(buffer, static_cast<std::size_t>(length));
+}
+
+// Decodes one argument from the payload and advances past it
+std::size_t appendArgument(std::string& out, const Record& record, std::size_t offset) {
+    const auto tag = static_cast<Record::Tag>(record.payload[offset]);
+    const char* data = record.payload + offset + 1;
+    char buffer[32];
+    
+    switch (tag) {
+        case Record::Signed: {
+            std::int64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            out += std::to_string(value);
+            return offset + 1 + sizeof(value);
+        }
+        case Record::Unsigned: {
+            std::uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            out += std::to_string(value);
+            return offset + 1 + sizeof(value);
+        }
+        case Record::Floating: {
+            double value;
+            std::memcpy(&value, data, sizeof(value));
+            const auto length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+            out.append(buffer, static_cast<std::size_t>(length));
+            return offset + 1 + sizeof(value);
+        }
+        case Record::Boolean: {
+            bool value;
+            std::memcpy(&value, data, sizeof(value));
+            out += value ? "true" : "false";
+            return offset + 1 + sizeof(value);
+        }
+        case Record::Text:
+        default: {
+            std::uint16_t length;
+            std::memcpy(&length, data, sizeof(length));
+            out.append(data + sizeof(length), length);
+            return offset + 1 + sizeof(length) + length;
+        }
+    }
+}
+
+void format(std::string& out, const Record& record) {
+    appendTimestamp(out, record.timestamp);
+    out += levelName(record.level);
+    out += ' ';
+    
+    std::size_t offset = 0;
+    unsigned remaining = record.argCount;
+    for (const char* p = record.format; *p; ++p) {
+        if (p[0] == '{' && p[1] == '}' && remaining > 0) {
+            offset = appendArgument(out, record, offset);
+            --remaining;
+            ++p;
+        } else {
+            out += *p;
+        }
+    }
+    if (record.truncated) {
+        out += " [truncated]";
+    }
+    out += '\n';
+}
+
+// Drains every ring once; returns whether anything was written
+bool drain(std::string& out, std::string& errors) {
+    auto& reg = registry();
+    bool wrote = false;
+    
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto it = reg.rings.begin(); it != reg.rings.end();) {
+        auto& ring = **it;
+        const bool closed = ring.closed();
+        while (const auto* record = ring.front()) {
+            format(record->level >= Level::Warn ? errors : out, *record);
+            ring.pop();
+            wrote = true;
+        }
+        if (const auto dropped = ring.takeDropped()) {
+            errors += "Logger: dropped " + std::to_string(dropped) + " records from a full buffer\n";
+            wrote = true;
+        }
+        
+        // A closed ring is only released once its thread can no longer add to it
+        it = closed ? reg.rings.erase(it) : it + 1;
+    }
+    return wrote;
+}
+
+void writerLoop() {
+    auto& reg = registry();
+    std::string out;
+    std::string errors;
+    
+    for (;;) {
+        const bool running = reg.running.load(std::memory_order_acquire);
+        const bool wrote = drain(out, errors);
+        
+        if (!out.empty()) {
+            std::fwrite(out.data(), 1, out.size(), stdout);
+            std::fflush(stdout);
+            out.clear();
+        }
+        if (!errors.empty()) {
+            std::fwrite(errors.data(), 1, errors.size(), stderr);
+            errors.clear();
+        }
+        
+        if (!running && !wrote) {
+            break;
+        }
+        if (!wrote) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+}
+
+} // namespace
+
+std::atomic<Level> Logger::level_{CSP_NET_LOG_LEVEL <= 3 ? static_cast<Level>(CSP_NET_LOG_LEVEL) : Level::Off};
+
+void Logger::start() {
+    auto& reg = registry();
+    if (reg.running.exchange(true)) {
+        return;
+    }
+    reg.writer = std::thread(writerLoop);
+}
+
+void Logger::stop() {
+    auto& reg = registry();
+    if (!reg.running.exchange(false)) {
+        return;
+    }
+    reg.writer.join();
+}
+
+bool Logger::parseLevel(std::string_view name, Level& level) {
+    static constexpr std::pair<std::string_view, Level> names[] = {
+        { "debug", Level::Debug },
+        { "info", Level::Info },
+        { "warn", Level::Warn },
+        { "error", Level::Error },
+        { "off", Level::Off },
+    };
+    for (const auto& entry : names) {
+        if (entry.first == name) {
+            level = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+Record* Logger::claim() {
+    auto* record = threadRing().claim();
+    if (record) {
+        record->timestamp = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        record->argCount = 0;
+        record->size = 0;
+        record->truncated = false;
+    }
+    return record;
+}
+
+void Logger::commit() {
+    threadRing().commit();
+}
+
+} // namespace Logging
+} // namespace CSPNet
@@ -0,0 +1,145 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Lowest level compiled in; calls below it vanish, arguments included.
+// 0 = Debug, 1 = Info, 2 = Warn, 3 = Error (set by CMake)
+#ifndef CSP_NET_LOG_LEVEL
+#define CSP_NET_LOG_LEVEL 1
+#endif
+
+namespace CSPNet {
+namespace Logging {
+
+enum class Level : std::uint8_t {
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+// One log call as captured on the calling thread: the format literal and
+// the raw arguments. Text is produced later, on the writer thread.
+struct Record {
+    static constexpr std::size_t payloadSize = 224;
+    
+    enum Tag : std::uint8_t { Signed, Unsigned, Floating, Boolean, Text };
+    
+    std::uint64_t timestamp;    // nanoseconds since the epoch
+    const char* format;         // "{}" marks each argument
+    Level level;
+    std::uint8_t argCount;
+    std::uint16_t size;         // bytes of payload in use
+    bool truncated;
+    char payload[payloadSize];
+    
+    template <typename T>
+    void put(Tag tag, const T& value) {
+        if (size + 1 + sizeof(T) > payloadSize) {
+            truncated = true;
+            return;
+        }
+        payload[size] = static_cast<char>(tag);
+        std::memcpy(payload + size + 1, &value, sizeof(T));
+        size = static_cast<std::uint16_t>(size + 1 + sizeof(T));
+        ++argCount;
+    }
+    
+    void putText(std::string_view text) {
+        if (std::size_t(size) + 3 > payloadSize) {
+            truncated = true;
+            return;
+        }
+        const auto room = payloadSize - size - 3;
+        const auto length = static_cast<std::uint16_t>(text.size() < room ? text.size() : room);
+        truncated = truncated || length < text.size();
+        payload[size] = static_cast<char>(Text);
+        std::memcpy(payload + size + 1, &length, sizeof(length));
+        std::memcpy(payload + size + 3, text.data(), length);
+        size = static_cast<std::uint16_t>(size + 3 + length);
+        ++argCount;
+    }
+    
+    void add(bool value) { put(Boolean, value); }
+    void add(const char* value) { putText(value ? std::string_view(value) : std::string_view("(null)")); }
+    void add(std::string_view value) { putText(value); }
+    void add(const std::string& value) { putText(value); }
+    
+    template <typename T>
+    std::enable_if_t<std::is_arithmetic_v<T>> add(T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            put(Floating, static_cast<double>(value));
+        } else if constexpr (std::is_signed_v<T>) {
+            put(Signed, static_cast<std::int64_t>(value));
+        } else {
+            put(Unsigned, static_cast<std::uint64_t>(value));
+        }
+    }
+    
+    template <typename T>
+    std::enable_if_t<std::is_enum_v<T>> add(T value) {
+        add(static_cast<std::underlying_type_t<T>>(value));
+    }
+};
+
+// Asynchronous logger. Each thread appends records to its own lock-free
+// ring; a background thread formats and writes them. A full ring drops the
+// record and counts it, so callers never wait on I/O.
+class Logger {
+public:
+    // Starts the writer thread; records logged before this are kept until
+    // the calling thread's ring fills up
+    static void start();
+    
+    // Writes everything still queued and joins the writer thread
+    static void stop();
+    
+    static void setLevel(Level level) { level_.store(level, std::memory_order_relaxed); }
+    static Level level() { return level_.load(std::memory_order_relaxed); }
+    static bool enabled(Level level) { return level >= Logger::level(); }
+    
+    // Parses "debug", "info", "warn", "error" or "off"; false if unknown
+    static bool parseLevel(std::string_view name, Level& level);
+    
+    // The format must be a string literal; it is read by the writer thread
+    template <std::size_t N, typename... Args>
+    static void write(Level level, const char (&format)[N], const Args&... args) {
+        auto* record = claim();
+        if (!record) {
+            return;
+        }
+        record->level = level;
+        record->format = format;
+        (record->add(args), ...);
+        commit();
+    }
+    
+private:
+    static Record* claim();
+    static void commit();
+    
+    static std::atomic<Level> level_;
+};
+
+} // namespace Logging
+} // namespace CSPNet
+
+#define CSP_LOG(level, ...)                                                                  \
+    do {                                                                                     \
+        if constexpr (static_cast<int>(level) >= CSP_NET_LOG_LEVEL) {                        \
+            if (::CSPNet::Logging::Logger::enabled(level)) {                                 \
+                ::CSPNet::Logging::Logger::write(level, __VA_ARGS__);                        \
+            }                                                                                \
+        }                                                                                    \
+    } while (false)
+    
+#define CSP_LOG_DEBUG(...) CSP_LOG(::CSPNet::Logging::Level::Debug, __VA_ARGS__)
+#define CSP_LOG_INFO(...) CSP_LOG(::CSPNet::Logging::Level::Info, __VA_ARGS__)
+#define CSP_LOG_WARN(...) CSP_LOG(::CSPNet::Logging::Level::Warn, __VA_ARGS__)
+#define CSP_LOG_ERROR(...) CSP_LOG(::CSPNet::Logging::Level::Error, __VA_ARGS__)
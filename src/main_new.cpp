@@ -6,10 +6,106 @@ namespace std {
 
 #include <Wt/WServer.h>
 #include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "app/AdmissionController.h"
+#include "app/AdmissionGate.h"
 #include "app/Application.h"
+#include "app/ContentUpdates.h"
+#include "api/ApiClient.h"
+#include "api/ApiServer.h"
+#include "assets/AssetPipeline.h"
+#include "assets/AssetResource.h"
+#include "logging/Logger.h"
+#include "memory/AllocationTracker.h"
+#include "metrics/MetricsResource.h"
+#include "models/ContentStore.h"
+#include "models/SqliteContentRepository.h"
+#include "tasks/TaskExecutor.h"
+#include "styles/ThemeStyleSheet.h"
+#include "views/pages/StaticPages.h"
 
 using namespace Wt;
 
+namespace {
+
+// API listener settings from optional wt_config.xml <property> entries
+CSPNet::Api::ApiServerConfig apiConfigFrom(const WServer& server) {
+    CSPNet::Api::ApiServerConfig config;
+    std::string value;
+    if (server.readConfigurationProperty("csp-api-port", value)) {
+        config.port = static_cast<std::uint16_t>(std::stoul(value));
+    }
+    if (server.readConfigurationProperty("csp-api-threads", value)) {
+        config.threads = std::stoul(value);
+    }
+    return config;
+}
+
+// Admission watermarks from optional wt_config.xml <property> entries
+CSPNet::App::AdmissionPolicy admissionPolicyFrom(const WServer& server) {
+    CSPNet::App::AdmissionPolicy policy;
+    std::string value;
+    if (server.readConfigurationProperty("csp-max-sessions", value)) {
+        policy.maxSessions = std::stoul(value);
+    }
+    if (server.readConfigurationProperty("csp-max-rss-mb", value)) {
+        policy.maxRssBytes = std::stoull(value) * 1024 * 1024;
+    }
+    if (server.readConfigurationProperty("csp-memory-budget", value)) {
+        policy.maxSessionMemoryBytes = std::stoll(value);
+    }
+    if (server.readConfigurationProperty("csp-max-queue-delay-ms", value)) {
+        policy.maxQueueDelay = std::chrono::milliseconds(std::stol(value));
+    }
+    if (server.readConfigurationProperty("csp-overload-page", value) && value == "queue") {
+        policy.overflow = CSPNet::App::AdmissionPolicy::Overflow::QueuePage;
+    }
+    return policy;
+}
+
+void applyLogLevel(const WServer& server) {
+    std::string value;
+    CSPNet::Logging::Level level;
+    if (server.readConfigurationProperty("csp-log-level", value) &&
+        CSPNet::Logging::Logger::parseLevel(value, level)) {
+        CSPNet::Logging::Logger::setLevel(level);
+    }
+}
+
+// Controller task threads; 0 or unset means one per hardware thread
+std::size_t taskThreadsFrom(const WServer& server) {
+    std::string value;
+    if (server.readConfigurationProperty("csp-task-threads", value)) {
+        return std::stoul(value);
+    }
+    return 0;
+}
+
+// How long content publications are gathered before sessions hear of them
+std::chrono::milliseconds updateWindowFrom(const WServer& server) {
+    std::string value;
+    if (server.readConfigurationProperty("csp-update-window-ms", value)) {
+        return std::chrono::milliseconds(std::stol(value));
+    }
+    return std::chrono::milliseconds(250);
+}
+
+std::string contentFileFrom(const WServer& server) {
+    std::string path = "content/content.json";
+    server.readConfigurationProperty("csp-content-file", path);
+    return path;
+}
+
+// Empty unless features and credits are served from an SQLite database
+std::string contentDatabaseFrom(const WServer& server) {
+    std::string path;
+    server.readConfigurationProperty("csp-content-db", path);
+    return path;
+}
+
+} // namespace
+
 int main(int argc, char* argv[]) {
     try {
         std::cout << R"(
@@ -21,28 +117,142 @@ int main(int argc, char* argv[]) {
    
    ──────────────────────────────────────────────────────────────
         )" << std::endl;
+        
+        // Event handlers only queue log records; this thread writes them
+        CSPNet::Logging::Logger::start();
 
+        // Content-hash and gzip the generated stylesheet once at startup
+        CSPNet::Assets::AssetPipeline pipeline("static");
+        pipeline.addGenerated("/theme.css", CSPNet::Styles::ThemeStyleSheet::minifiedCss());
+        auto assets = pipeline.build();
+        
+        // Sessions link the compile-time theme URL; it must be one we serve
+        const auto themeUrl = assets->url("/theme.css");
+        if (themeUrl != CSPNet::Styles::ThemeStyleSheet::url()) {
+            throw std::runtime_error("theme stylesheet is served at " + themeUrl + " but sessions link " +
+                                     std::string(CSPNet::Styles::ThemeStyleSheet::url()));
+        }
+        std::vector<std::unique_ptr<CSPNet::Assets::AssetResource>> assetResources;
+        std::vector<std::unique_ptr<CSPNet::Assets::AssetResource>> pageResources;
+        
         // Setup Wt server
         WServer server(argc, argv, WTHTTP_CONFIGURATION);
-        server.addEntryPoint(EntryPointType::Application, CSPNet::App::createApplication);
+        applyLogLevel(server);
+        
+        // Features and credits come from the content file; built-in content
+        // stays live if it is missing or invalid
+        CSPNet::Models::ContentStore content(contentFileFrom(server));
+        content.load();
+        
+        // With a content database, credits are paged from SQLite instead of
+        // held in the snapshot; the content file only seeds an empty database
+        std::shared_ptr<CSPNet::Models::SqliteContentRepository> database;
+        const auto databasePath = contentDatabaseFrom(server);
+        if (!databasePath.empty()) {
+            database = std::make_shared<CSPNet::Models::SqliteContentRepository>(databasePath);
+            if (database->features().empty() && database->creditCount() == 0) {
+                auto seed = CSPNet::Models::ContentSnapshot::current();
+                database->replaceContent(seed->features(), seed->credits());
+            }
+            CSPNet::Models::AppData::setRepository(database);
+            CSPNet::Models::ContentSnapshot::publish(std::make_shared<const CSPNet::Models::ContentSnapshot>(
+                database->features(), std::vector<CSPNet::Models::CreditModel>()));
+        }
+        
+        // Pre-render Home and Credits for session-less first visits
+        using CSPNet::Views::Pages::StaticPages;
+        auto staticPages = StaticPages::render();
+        
+        for (const auto& asset : assets->assets()) {
+            assetResources.push_back(std::make_unique<CSPNet::Assets::AssetResource>(assets, asset));
+            server.addResource(assetResources.back().get(), asset.url);
+        }
+        for (const auto& page : staticPages->assets()) {
+            pageResources.push_back(std::make_unique<CSPNet::Assets::AssetResource>(
+                staticPages, page, CSPNet::Assets::AssetResource::revalidate));
+            server.addResource(pageResources.back().get(), page.url);
+        }
+        
+        // Re-render the static pages whenever new content is published, and
+        // push the changes to open sessions
+        content.setReloadCallback([&pageResources](const auto& snapshot) {
+            auto pages = StaticPages::render();
+            for (auto& resource : pageResources) {
+                resource->update(pages);
+            }
+            CSPNet::App::ContentUpdates::published(snapshot);
+        });
+        
+        // Sessions are only created once a visitor enters the application,
+        // and only while the server is under its admission watermarks
+        CSPNet::App::AdmissionController admission(admissionPolicyFrom(server));
+        server.addEntryPoint(EntryPointType::Application, admission.wrap(CSPNet::App::createApplication),
+                             StaticPages::applicationUrl);
+        CSPNet::App::AdmissionGate gate(admission);
+        server.addResource(&gate, StaticPages::enterUrl);
+        
+        // Prometheus scrape endpoint for the operation timers, session
+        // memory, admission state, controller tasks and content updates
+        CSPNet::Metrics::MetricsResource metrics;
+        metrics.addCollector(CSPNet::Memory::renderPrometheus);
+        metrics.addCollector([&admission]() { return admission.renderPrometheus(); });
+        metrics.addCollector(CSPNet::Tasks::TaskExecutor::renderPrometheus);
+        metrics.addCollector(CSPNet::App::ContentUpdates::renderPrometheus);
+        server.addResource(&metrics, CSPNet::Metrics::MetricsResource::path);
+        
+        // Backend API on its own Drogon event loops
+        CSPNet::Api::ApiServer api(apiConfigFrom(server));
         
         if (server.start()) {
+            // Controller work runs here instead of on the Wt event threads
+            CSPNet::Tasks::TaskExecutor::start(taskThreadsFrom(server));
+            api.start();
+            CSPNet::Api::ApiClient::start(api.config());
+            CSPNet::App::ContentUpdates::start(updateWindowFrom(server));
+            if (!database) {
+                content.watch();
+            }
+            admission.start(server);
+            
             std::cout << "\n🎉 CSP-NET Platform Ready!" << std::endl;
-            std::cout << "Frontend:      http://localhost:8080" << std::endl;
+            std::cout << "Frontend:      http://localhost:8080 (pre-rendered, no session)" << std::endl;
+            std::cout << "Application:   http://localhost:8080" << StaticPages::enterUrl << " (admission gate)" << std::endl;
+            std::cout << "Backend API:   http://localhost:" << api.config().port << "/api/health"
+                      << " (" << api.config().threads << " threads)" << std::endl;
+            std::cout << "Tasks:         " << CSPNet::Tasks::TaskExecutor::threads() << " work-stealing threads" << std::endl;
+            std::cout << "Metrics:       http://localhost:8080" << CSPNet::Metrics::MetricsResource::path << std::endl;
             std::cout << "Architecture:  MVC + SPA Pattern" << std::endl;
             std::cout << "Framework:     Wt with Apple Design System" << std::endl;
             std::cout << "Structure:     Modular Components & Controllers" << std::endl;
             std::cout << "Navigation:    Home • Credits (SPA Routing)" << std::endl;
-            std::cout << "CSS Method:    styleSheet().addRule() (recommended)" << std::endl;
+            std::cout << "Stylesheet:    " << assets->url("/theme.css") << " (shared, immutable)" << std::endl;
+            if (database) {
+                std::cout << "Content:       " << database->path() << " (SQLite, WAL, credits paged)" << std::endl;
+            } else {
+                std::cout << "Content:       " << content.path() << " (reloaded on change, pushed to sessions)" << std::endl;
+            }
+            std::cout << "Assets:        " << assets->assets().size() << " precompressed (static/assets/manifest.json)" << std::endl;
             std::cout << "\nPress Ctrl+C to stop\n" << std::endl;
             
             WServer::waitForShutdown();
+            content.stop();
+            CSPNet::App::ContentUpdates::stop();
+            CSPNet::Api::ApiClient::stop();
+            api.stop();
+            admission.stop();
+            
+            // Join the task threads before sessions go away; events that
+            // still arrive run their work inline
+            CSPNet::Tasks::TaskExecutor::stop();
+            server.stop();
         }
         
+        CSPNet::Logging::Logger::stop();
         std::cout << "CSP-NET Platform stopped" << std::endl;
         return 0;
         
     } catch (const std::exception& e) {
+        CSPNet::Logging::Logger::stop();
         std::cerr << "Fatal error: " << e.what() << std::endl;
         return 1;
     }
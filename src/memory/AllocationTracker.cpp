@@ -0,0 +1,303 @@
+#include "AllocationTracker.h"
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <vector>
+#include "../logging/Logger.h"
+
+namespace CSPNet {
+namespace Memory {
+
+namespace {
+
+// Per-session counters, indexed by SessionAccount::slot(). A slot's
+// generation changes whenever it is released, so frees of blocks charged
+// to an earlier owner are ignored.
+struct alignas(64) Slot {
+    std::atomic<std::uint32_t> generation{0};
+    std::atomic<bool> inUse{false};
+    std::atomic<std::int64_t> liveBytes{0};
+    std::atomic<std::uint64_t> allocatedBytes{0};
+    std::atomic<std::uint64_t> allocations{0};
+};
+
+constexpr std::size_t slotCount = 16384;
+Slot slots[slotCount];
+
+struct SlotPool {
+    std::mutex mutex;
+    std::vector<std::uint32_t> free;
+    std::uint32_t next = 0;
+    std::size_t inUse = 0;
+};
+
+SlotPool& slotPool() {
+    static SlotPool pool;
+    return pool;
+}
+
+struct Tags {
+    std::mutex mutex;
+    std::deque<AllocationTag> entries;
+};
+
+Tags& tags() {
+    static Tags instance;
+    return instance;
+}
+
+// What the calling thread's allocations are charged to. Constant
+// initialized, so the operator new hook can use it at any time.
+struct Context {
+    std::uint32_t slot = SessionAccount::untracked;
+    std::uint32_t generation = 0;
+    AllocationTag* page = nullptr;
+    AllocationTag* component = nullptr;
+};
+
+thread_local Context context;
+
+} // namespace
+
+AllocationTag& AllocationTag::get(Kind kind, const std::string& name) {
+    auto& all = tags();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    for (auto& tag : all.entries) {
+        if (tag.kind() == kind && tag.name() == name) {
+            return tag;
+        }
+    }
+    return all.entries.emplace_back(kind, name);
+}
+
+SessionAccount::SessionAccount() : slot_(untracked), generation_(0) {
+    if (!enabled()) {
+        return;
+    }
+    
+    auto& pool = slotPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if (!pool.free.empty()) {
+        slot_ = pool.free.back();
+        pool.free.pop_back();
+    } else if (pool.next < slotCount) {
+        slot_ = pool.next++;
+    } else {
+        CSP_LOG_WARN("Memory: all {} session slots in use, session not tracked", slotCount);
+        return;
+    }
+    
+    auto& slot = slots[slot_];
+    generation_ = slot.generation.load(std::memory_order_relaxed);
+    slot.liveBytes.store(0, std::memory_order_relaxed);
+    slot.allocatedBytes.store(0, std::memory_order_relaxed);
+    slot.allocations.store(0, std::memory_order_relaxed);
+    slot.inUse.store(true, std::memory_order_release);
+    ++pool.inUse;
+}
+
+SessionAccount::~SessionAccount() {
+    if (slot_ == untracked) {
+        return;
+    }
+    
+    auto& slot = slots[slot_];
+    slot.inUse.store(false, std::memory_order_release);
+    slot.generation.fetch_add(1, std::memory_order_relaxed);
+    
+    auto& pool = slotPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.free.push_back(slot_);
+    --pool.inUse;
+}
+
+std::int64_t SessionAccount::liveBytes() const {
+    return slot_ == untracked ? 0 : slots[slot_].liveBytes.load(std::memory_order_relaxed);
+}
+
+AllocationStats SessionAccount::allocated() const {
+    if (slot_ == untracked) {
+        return {};
+    }
+    return { slots[slot_].allocatedBytes.load(std::memory_order_relaxed),
+             slots[slot_].allocations.load(std::memory_order_relaxed) };
+}
+
+bool SessionAccount::enabled() {
+#ifdef CSP_NET_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::int64_t SessionAccount::totalLiveBytes() {
+    std::int64_t total = 0;
+    for (const auto& slot : slots) {
+        if (slot.inUse.load(std::memory_order_acquire)) {
+            total += slot.liveBytes.load(std::memory_order_relaxed);
+        }
+    }
+    return total;
+}
+
+std::size_t SessionAccount::count() {
+    auto& pool = slotPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.inUse;
+}
+
+SessionScope::SessionScope(const SessionAccount& account)
+    : slot_(context.slot), generation_(context.generation) {
+    context.slot = account.slot();
+    context.generation = account.generation();
+}
+
+SessionScope::~SessionScope() {
+    context.slot = slot_;
+    context.generation = generation_;
+}
+
+TagScope::TagScope(AllocationTag& tag) : kind_(tag.kind()) {
+    auto& current = kind_ == AllocationTag::Page ? context.page : context.component;
+    previous_ = current;
+    current = &tag;
+}
+
+TagScope::~TagScope() {
+    (kind_ == AllocationTag::Page ? context.page : context.component) = previous_;
+}
+
+std::string renderPrometheus() {
+    std::int64_t total = 0;
+    std::int64_t largest = 0;
+    std::size_t sessions = 0;
+    for (const auto& slot : slots) {
+        if (slot.inUse.load(std::memory_order_acquire)) {
+            const auto live = slot.liveBytes.load(std::memory_order_relaxed);
+            total += live;
+            largest = std::max(largest, live);
+            ++sessions;
+        }
+    }
+    
+    std::string out;
+    out += "# HELP csp_net_session_memory_bytes Live heap bytes charged to sessions.\n"
+           "# TYPE csp_net_session_memory_bytes gauge\n"
+           "csp_net_session_memory_bytes " + std::to_string(total) + "\n"
+           "# HELP csp_net_session_memory_max_bytes Live heap bytes of the largest session.\n"
+           "# TYPE csp_net_session_memory_max_bytes gauge\n"
+           "csp_net_session_memory_max_bytes " + std::to_string(largest) + "\n"
+           "# HELP csp_net_tracked_sessions Sessions with a memory account.\n"
+           "# TYPE csp_net_tracked_sessions gauge\n"
+           "csp_net_tracked_sessions " + std::to_string(sessions) + "\n";
+    
+    std::string bytes;
+    std::string count;
+    {
+        auto& all = tags();
+        std::lock_guard<std::mutex> lock(all.mutex);
+        for (const auto& tag : all.entries) {
+            const auto stats = tag.stats();
+            const auto labels = std::string("{kind=\"") + (tag.kind() == AllocationTag::Page ? "page" : "component") +
+                                "\",name=\"" + tag.name() + "\"} ";
+            bytes += "csp_net_allocated_bytes_total" + labels + std::to_string(stats.bytes) + "\n";
+            count += "csp_net_allocations_total" + labels + std::to_string(stats.count) + "\n";
+        }
+    }
+    out += "# HELP csp_net_allocated_bytes_total Heap bytes allocated while building a page or component.\n"
+           "# TYPE csp_net_allocated_bytes_total counter\n" + bytes +
+           "# HELP csp_net_allocations_total Heap allocations made while building a page or component.\n"
+           "# TYPE csp_net_allocations_total counter\n" + count;
+    return out;
+}
+
+} // namespace Memory
+} // namespace CSPNet
+
+#ifdef CSP_NET_TRACK_ALLOCATIONS
+
+// Global operator new hook. Every block carries a header naming the
+// session slot it was charged to, so it can be credited back on free.
+// Aligned new/delete are left to the library; they never see a header.
+namespace {
+
+using CSPNet::Memory::SessionAccount;
+using CSPNet::Memory::context;
+using CSPNet::Memory::slots;
+
+struct alignas(16) BlockHeader {
+    std::uint64_t size;
+    std::uint32_t slot;
+    std::uint32_t generation;
+};
+static_assert(sizeof(BlockHeader) == 16, "header must keep malloc's alignment");
+
+void* trackedAlloc(std::size_t size) noexcept {
+    auto header = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + size));
+    if (!header) {
+        return nullptr;
+    }
+    
+    header->size = size;
+    header->slot = context.slot;
+    header->generation = context.generation;
+    if (context.slot != SessionAccount::untracked) {
+        auto& slot = slots[context.slot];
+        slot.liveBytes.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+        slot.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        slot.allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (context.page) {
+        context.page->record(size);
+    }
+    if (context.component) {
+        context.component->record(size);
+    }
+    return header + 1;
+}
+
+void* trackedNew(std::size_t size) {
+    for (;;) {
+        if (auto block = trackedAlloc(size)) {
+            return block;
+        }
+        auto handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void trackedFree(void* block) noexcept {
+    if (!block) {
+        return;
+    }
+    
+    auto header = static_cast<BlockHeader*>(block) - 1;
+    if (header->slot != SessionAccount::untracked) {
+        auto& slot = slots[header->slot];
+        if (slot.generation.load(std::memory_order_relaxed) == header->generation) {
+            slot.liveBytes.fetch_sub(static_cast<std::int64_t>(header->size), std::memory_order_relaxed);
+        }
+    }
+    std::free(header);
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return trackedNew(size); }
+void* operator new[](std::size_t size) { return trackedNew(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+void operator delete(void* block) noexcept { trackedFree(block); }
+void operator delete[](void* block) noexcept { trackedFree(block); }
+void operator delete(void* block, std::size_t) noexcept { trackedFree(block); }
+void operator delete[](void* block, std::size_t) noexcept { trackedFree(block); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { trackedFree(block); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { trackedFree(block); }
+
+#endif
@@ -0,0 +1,134 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace CSPNet {
+namespace Memory {
+
+struct AllocationStats {
+    std::uint64_t bytes = 0;
+    std::uint64_t count = 0;
+};
+
+// Heap allocated while a page or a component type was being built,
+// summed over all sessions. Tags are created once and never destroyed.
+class AllocationTag {
+public:
+    enum Kind : std::uint8_t { Page, Component };
+    
+    AllocationTag(Kind kind, std::string name) : kind_(kind), name_(std::move(name)) {}
+    
+    // Returns the tag for a name, creating it on first use
+    static AllocationTag& get(Kind kind, const std::string& name);
+    
+    void record(std::size_t bytes) {
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    Kind kind() const { return kind_; }
+    const std::string& name() const { return name_; }
+    AllocationStats stats() const {
+        return { bytes_.load(std::memory_order_relaxed), count_.load(std::memory_order_relaxed) };
+    }
+    
+private:
+    Kind kind_;
+    std::string name_;
+    std::atomic<std::uint64_t> bytes_{0};
+    std::atomic<std::uint64_t> count_{0};
+};
+
+// Live heap of one session. Allocations made on a thread while a
+// SessionScope for the account is active are charged to it, and credited
+// back when freed, whichever thread frees them. Blocks still alive when the
+// account is destroyed are forgotten, not charged to the slot's next owner.
+//
+// Accounting needs the operator new hook (CSP_NET_TRACK_ALLOCATIONS);
+// without it every account reads zero.
+class SessionAccount {
+public:
+    static constexpr std::uint32_t untracked = ~std::uint32_t(0);
+    
+    SessionAccount();
+    ~SessionAccount();
+    
+    SessionAccount(const SessionAccount&) = delete;
+    SessionAccount& operator=(const SessionAccount&) = delete;
+    
+    std::int64_t liveBytes() const;
+    AllocationStats allocated() const;
+    
+    std::uint32_t slot() const { return slot_; }
+    std::uint32_t generation() const { return generation_; }
+    
+    static bool enabled();
+    
+    // Over all live accounts
+    static std::int64_t totalLiveBytes();
+    static std::size_t count();
+    
+private:
+    std::uint32_t slot_;
+    std::uint32_t generation_;
+};
+
+// Charges the calling thread's allocations to an account for the lifetime
+// of the scope; scopes nest
+class SessionScope {
+public:
+    explicit SessionScope(const SessionAccount& account);
+    ~SessionScope();
+    
+    SessionScope(const SessionScope&) = delete;
+    SessionScope& operator=(const SessionScope&) = delete;
+    
+private:
+    std::uint32_t slot_;
+    std::uint32_t generation_;
+};
+
+// Also records the calling thread's allocations under a page or component
+// tag; an inner scope of the same kind takes over until it ends
+class TagScope {
+public:
+    explicit TagScope(AllocationTag& tag);
+    ~TagScope();
+    
+    TagScope(const TagScope&) = delete;
+    TagScope& operator=(const TagScope&) = delete;
+    
+private:
+    AllocationTag* previous_;
+    AllocationTag::Kind kind_;
+};
+
+// Budget for one session's live heap
+struct SessionBudget {
+    enum class Action { Log, Shed };
+    
+    // 0 = unlimited
+    std::int64_t maxBytes = 0;
+    // Shed releases lazily built pages before logging
+    Action action = Action::Log;
+};
+
+// Gauges for live session memory and counters per page and component,
+// in Prometheus text format
+std::string renderPrometheus();
+
+} // namespace Memory
+} // namespace CSPNet
+
+#define CSP_MEMORY_CONCAT_(a, b) a##b
+#define CSP_MEMORY_CONCAT(a, b) CSP_MEMORY_CONCAT_(a, b)
+
+// Records the rest of the enclosing scope's allocations under a component type
+#define CSP_COMPONENT_ALLOCATIONS(name)                                                       \
+    static ::CSPNet::Memory::AllocationTag& CSP_MEMORY_CONCAT(cspAllocationTag_, __LINE__) =  \
+        ::CSPNet::Memory::AllocationTag::get(::CSPNet::Memory::AllocationTag::Component, name); \
+    ::CSPNet::Memory::TagScope CSP_MEMORY_CONCAT(cspAllocationScope_, __LINE__)(              \
+        CSP_MEMORY_CONCAT(cspAllocationTag_, __LINE__))
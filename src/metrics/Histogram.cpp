@@ -0,0 +1,88 @@
+#include "Histogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace CSPNet {
+namespace Metrics {
+
+std::uint64_t HistogramSnapshot::valueAt(double quantile) const {
+    if (count == 0) {
+        return 0;
+    }
+    
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(
+        std::ceil(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(count))));
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < counts.size(); ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            // Midpoint of the bucket the rank falls into
+            const auto low = Histogram::lowerBound(bucket);
+            return low + (Histogram::upperBound(bucket) - low) / 2;
+        }
+    }
+    return Histogram::upperBound(counts.size() - 1);
+}
+
+std::size_t Histogram::bucketOf(std::uint64_t value) {
+    if (value < subBucketCount) {
+        return static_cast<std::size_t>(value);
+    }
+    
+    const auto maxValue = (std::uint64_t(1) << maxValueBits) - 1;
+    value = std::min(value, maxValue);
+    
+    // Position of the highest bit picks the power of two, the next
+    // subBucketBits bits pick the linear bucket inside it
+    const auto msb = static_cast<unsigned>(63 - __builtin_clzll(value));
+    const auto shift = msb - subBucketBits;
+    const auto sub = static_cast<std::size_t>(value >> shift) - subBucketCount;
+    return subBucketCount * (shift + 1) + sub;
+}
+
+std::uint64_t Histogram::lowerBound(std::size_t bucket) {
+    if (bucket < subBucketCount) {
+        return bucket;
+    }
+    const auto shift = bucket / subBucketCount - 1;
+    const auto sub = bucket % subBucketCount;
+    return static_cast<std::uint64_t>(subBucketCount + sub) << shift;
+}
+
+std::uint64_t Histogram::upperBound(std::size_t bucket) {
+    if (bucket < subBucketCount) {
+        return bucket;
+    }
+    const auto shift = bucket / subBucketCount - 1;
+    return lowerBound(bucket) + (std::uint64_t(1) << shift) - 1;
+}
+
+std::size_t Histogram::shardIndex() {
+    static std::atomic<std::size_t> nextShard{0};
+    thread_local const std::size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % shardCount;
+    return shard;
+}
+
+void Histogram::record(std::uint64_t value) {
+    auto& shard = shards_[shardIndex()];
+    shard.counts[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+HistogramSnapshot Histogram::snapshot() const {
+    HistogramSnapshot merged;
+    merged.counts.assign(bucketCount, 0);
+    
+    for (const auto& shard : shards_) {
+        for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+            const auto n = shard.counts[bucket].load(std::memory_order_relaxed);
+            merged.counts[bucket] += n;
+            merged.count += n;
+        }
+        merged.sum += shard.sum.load(std::memory_order_relaxed);
+    }
+    return merged;
+}
+
+} // namespace Metrics
+} // namespace CSPNet
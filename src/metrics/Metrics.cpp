@@ -0,0 +1,76 @@
+#include "Metrics.h"
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace CSPNet {
+namespace Metrics {
+
+namespace {
+
+constexpr const char* family = "csp_net_operation_duration_seconds";
+constexpr double quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+
+struct Timers {
+    std::mutex mutex;
+    std::vector<std::pair<std::string, std::unique_ptr<Histogram>>> entries;
+};
+
+Timers& timers() {
+    static Timers instance;
+    return instance;
+}
+
+void appendSeconds(std::string& out, std::uint64_t nanoseconds) {
+    char buffer[32];
+    const auto length = std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(nanoseconds) / 1e9);
+    out.append(buffer, static_cast<std::size_t>(length));
+}
+
+} // namespace
+
+Histogram& Registry::timer(const char* operation) {
+    auto& all = timers();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    for (auto& entry : all.entries) {
+        if (entry.first == operation) {
+            return *entry.second;
+        }
+    }
+    all.entries.emplace_back(operation, std::make_unique<Histogram>());
+    return *all.entries.back().second;
+}
+
+std::string Registry::renderPrometheus() {
+    std::string out;
+    out += "# HELP ";
+    out += family;
+    out += " Duration of instrumented operations.\n# TYPE ";
+    out += family;
+    out += " summary\n";
+    
+    auto& all = timers();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    for (const auto& entry : all.entries) {
+        const auto snapshot = entry.second->snapshot();
+        const auto label = "{operation=\"" + entry.first + "\"";
+    
+        for (double quantile : quantiles) {
+            char buffer[16];
+            std::snprintf(buffer, sizeof(buffer), "%g", quantile);
+            out += family + label + ",quantile=\"" + buffer + "\"} ";
+            appendSeconds(out, snapshot.valueAt(quantile));
+            out += '\n';
+        }
+        out += std::string(family) + "_sum" + label + "} ";
+        appendSeconds(out, snapshot.sum);
+        out += '\n';
+        out += std::string(family) + "_count" + label + "} " + std::to_string(snapshot.count) + "\n";
+    }
+    return out;
+}
+
+} // namespace Metrics
+} // namespace CSPNet
@@ -0,0 +1,70 @@
+#pragma once
+#include <chrono>
+#include <string>
+#include "Histogram.h"
+
+namespace CSPNet {
+namespace Metrics {
+
+// Named latency histograms, exported as one Prometheus summary family
+// (csp_net_operation_duration_seconds) labelled by operation
+class Registry {
+public:
+    // Returns the histogram for an operation, creating it on first use.
+    // Look it up once and keep the reference; see CSP_TIME_SCOPE.
+    static Histogram& timer(const char* operation);
+    
+    // Prometheus text exposition format, version 0.0.4
+    static std::string renderPrometheus();
+};
+
+// Records the lifetime of the scope into a histogram, in nanoseconds
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Histogram& histogram)
+        : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+    
+    ~ScopedTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        histogram_.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    
+private:
+    Histogram& histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Records the time since construction on each record(); copyable, so it
+// can travel with work that completes on another thread
+class Stopwatch {
+public:
+    explicit Stopwatch(Histogram& histogram)
+        : histogram_(&histogram), start_(std::chrono::steady_clock::now()) {}
+    
+    void record() const {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        histogram_->record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    
+private:
+    Histogram* histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace Metrics
+} // namespace CSPNet
+
+#define CSP_METRICS_CONCAT_(a, b) a##b
+#define CSP_METRICS_CONCAT(a, b) CSP_METRICS_CONCAT_(a, b)
+
+// Times the rest of the enclosing scope as the named operation
+#define CSP_TIME_SCOPE(operation)                                                            \
+    static ::CSPNet::Metrics::Histogram& CSP_METRICS_CONCAT(cspTimerHistogram_, __LINE__) =  \
+        ::CSPNet::Metrics::Registry::timer(operation);                                       \
+    ::CSPNet::Metrics::ScopedTimer CSP_METRICS_CONCAT(cspTimer_, __LINE__)(                  \
+        CSP_METRICS_CONCAT(cspTimerHistogram_, __LINE__))
@@ -0,0 +1,27 @@
+#include "MetricsResource.h"
+#include <Wt/Http/Request.h>
+#include <Wt/Http/Response.h>
+#include "Metrics.h"
+
+namespace CSPNet {
+namespace Metrics {
+
+MetricsResource::MetricsResource() {
+}
+
+MetricsResource::~MetricsResource() {
+    beingDeleted();
+}
+
+void MetricsResource::handleRequest(const Wt::Http::Request&, Wt::Http::Response& response) {
+    auto body = Registry::renderPrometheus();
+    for (const auto& collector : collectors_) {
+        body += collector();
+    }
+    response.setMimeType("text/plain; version=0.0.4");
+    response.addHeader("Cache-Control", "no-store");
+    response.out().write(body.data(), static_cast<std::streamsize>(body.size()));
+}
+
+} // namespace Metrics
+} // namespace CSPNet
@@ -0,0 +1,31 @@
+#pragma once
+#include <Wt/WResource.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace CSPNet {
+namespace Metrics {
+
+// Serves the operation timers, followed by each collector's output, for
+// Prometheus to scrape
+class MetricsResource : public Wt::WResource {
+public:
+    using Collector = std::function<std::string()>;
+    
+    static constexpr const char* path = "/metrics";
+    
+    MetricsResource();
+    ~MetricsResource() override;
+    
+    // Add collectors before the server starts
+    void addCollector(Collector collector) { collectors_.push_back(std::move(collector)); }
+    
+    void handleRequest(const Wt::Http::Request& request, Wt::Http::Response& response) override;
+    
+private:
+    std::vector<Collector> collectors_;
+};
+
+} // namespace Metrics
+} // namespace CSPNet
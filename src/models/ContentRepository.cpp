@@ -0,0 +1,29 @@
+#include "ContentRepository.h"
+#include "ContentSnapshot.h"
+
+namespace CSPNet {
+namespace Models {
+
+std::vector<FeatureModel> SnapshotContentRepository::features() const {
+    return ContentSnapshot::current()->features();
+}
+
+std::size_t SnapshotContentRepository::creditCount() const {
+    return ContentSnapshot::current()->creditCount();
+}
+
+CreditPage SnapshotContentRepository::credits(std::int64_t from, std::size_t limit) const {
+    auto snapshot = ContentSnapshot::current();
+    const auto offset = static_cast<std::size_t>(from < 0 ? 0 : from);
+    
+    CreditPage page;
+    page.credits = snapshot->credits(offset, limit);
+    // An empty page has no next: a link back to itself would never end
+    if (!page.credits.empty() && offset + page.credits.size() < snapshot->creditCount()) {
+        page.next = static_cast<std::int64_t>(offset + page.credits.size());
+    }
+    return page;
+}
+
+} // namespace Models
+} // namespace CSPNet
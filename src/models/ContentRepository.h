@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "FeatureModel.h"
+
+namespace CSPNet {
+namespace Models {
+
+// One keyset page of credits. Credits are keyed by their position in the
+// list, which is dense and starts at 0, so a list offset is also a key.
+struct CreditPage {
+    std::vector<CreditModel> credits;
+    // Key of the first credit of the next page; -1 after the last page
+    std::int64_t next = -1;
+};
+
+// Where AppData reads content from. Implementations are shared by every
+// session and must be safe to call from any thread.
+class ContentRepository {
+public:
+    virtual ~ContentRepository() = default;
+    
+    virtual std::vector<FeatureModel> features() const = 0;
+    virtual std::size_t creditCount() const = 0;
+    
+    // Up to limit credits in position order, the first at position from
+    virtual CreditPage credits(std::int64_t from, std::size_t limit) const = 0;
+    
+    // True if the published ContentSnapshot holds all of this content, so
+    // its pre-serialized JSON can be served as is
+    virtual bool inSnapshot() const = 0;
+};
+
+// Serves whatever ContentSnapshot is current; the default repository
+class SnapshotContentRepository : public ContentRepository {
+public:
+    std::vector<FeatureModel> features() const override;
+    std::size_t creditCount() const override;
+    CreditPage credits(std::int64_t from, std::size_t limit) const override;
+    bool inSnapshot() const override { return true; }
+};
+
+} // namespace Models
+} // namespace CSPNet
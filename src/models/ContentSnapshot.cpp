@@ -0,0 +1,104 @@
+#include "ContentSnapshot.h"
+#include <algorithm>
+#include <atomic>
+#include "../assets/Compression.h"
+#include "../utils/ContentHash.h"
+#include "../utils/Json.h"
+
+namespace CSPNet {
+namespace Models {
+
+namespace {
+
+// Length of the page of at most limit items starting at offset
+constexpr std::size_t pageLength(std::size_t size, std::size_t offset, std::size_t limit) {
+    return offset >= size ? 0 : std::min(limit, size - offset);
+}
+
+static_assert(pageLength(300, 0, 100) == 100, "first page");
+static_assert(pageLength(300, 100, 100) == 100, "page after the first");
+static_assert(pageLength(300, 10, 100) == 100, "unaligned offset");
+static_assert(pageLength(300, 290, 100) == 10, "last partial page");
+static_assert(pageLength(300, 300, 100) == 0, "offset at the end");
+static_assert(pageLength(300, 400, 100) == 0, "offset past the end");
+
+SerializedBody serialize(std::string json) {
+    SerializedBody body;
+    const auto hash = Utils::toHex(Utils::contentHash(json));
+    body.etag = "\"" + hash + "\"";
+    
+    // Tiny bodies can grow under gzip; keep only a variant that pays off
+    auto compressed = Assets::gzipCompress(json);
+    if (compressed.size() < json.size()) {
+        body.gzip = std::move(compressed);
+        body.gzipEtag = "\"" + hash + ".gz\"";
+    }
+    body.json = std::move(json);
+    return body;
+}
+
+std::string featuresToJson(const std::vector<FeatureModel>& features) {
+    std::string json = "[";
+    for (std::size_t i = 0; i < features.size(); ++i) {
+        json += i > 0 ? ",{\"title\":" : "{\"title\":";
+        Utils::appendJsonString(json, features[i].title);
+        json += ",\"description\":";
+        Utils::appendJsonString(json, features[i].description);
+        json += ",\"icon\":";
+        Utils::appendJsonString(json, features[i].icon);
+        json += "}";
+    }
+    json += "]";
+    return json;
+}
+
+// Seeded with the built-in content on first use
+std::shared_ptr<const ContentSnapshot>& currentSnapshot() {
+    static std::shared_ptr<const ContentSnapshot> snapshot =
+        std::make_shared<const ContentSnapshot>(AppData::defaultFeatures(), AppData::defaultCredits());
+    return snapshot;
+}
+
+} // namespace
+
+std::string creditsToJson(const std::vector<CreditModel>& credits) {
+    std::string json = "[";
+    for (std::size_t i = 0; i < credits.size(); ++i) {
+        json += i > 0 ? ",{\"name\":" : "{\"name\":";
+        Utils::appendJsonString(json, credits[i].name);
+        json += ",\"role\":";
+        Utils::appendJsonString(json, credits[i].role);
+        json += ",\"avatar\":";
+        Utils::appendJsonString(json, credits[i].avatar);
+        json += "}";
+    }
+    json += "]";
+    return json;
+}
+
+ContentSnapshot::ContentSnapshot(std::vector<FeatureModel> features, std::vector<CreditModel> credits)
+    : features_(std::move(features)),
+      credits_(std::move(credits)),
+      featuresJson_(serialize(featuresToJson(features_))),
+      creditsJson_(serialize(creditsToJson(credits_))) {
+}
+
+std::vector<CreditModel> ContentSnapshot::credits(std::size_t offset, std::size_t limit) const {
+    const auto length = pageLength(credits_.size(), offset, limit);
+    if (length == 0) {
+        return {};
+    }
+    const auto first = credits_.begin() + static_cast<std::ptrdiff_t>(offset);
+    return std::vector<CreditModel>(first, first + static_cast<std::ptrdiff_t>(length));
+}
+
+std::shared_ptr<const ContentSnapshot> ContentSnapshot::current() {
+    return std::atomic_load(&currentSnapshot());
+}
+
+void ContentSnapshot::publish(std::shared_ptr<const ContentSnapshot> snapshot) {
+    std::atomic_store(&currentSnapshot(), std::move(snapshot));
+}
+
+} // namespace Models
+} // namespace CSPNet
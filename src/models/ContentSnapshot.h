@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "FeatureModel.h"
+
+namespace CSPNet {
+namespace Models {
+
+// A response body serialized once, in identity and gzip form
+struct SerializedBody {
+    std::string json;
+    std::string gzip;       // empty when compression does not pay off
+    std::string etag;       // strong ETag of json
+    std::string gzipEtag;   // strong ETag of gzip
+};
+
+// The JSON array served by /api/credits, for pages built outside a snapshot
+std::string creditsToJson(const std::vector<CreditModel>& credits);
+
+// Immutable view of all content plus its pre-serialized JSON. Published
+// snapshots are swapped atomically; readers hold a shared_ptr for as long
+// as they need one and never see a partially updated set.
+class ContentSnapshot {
+public:
+    ContentSnapshot(std::vector<FeatureModel> features, std::vector<CreditModel> credits);
+    
+    const std::vector<FeatureModel>& features() const { return features_; }
+    const std::vector<CreditModel>& credits() const { return credits_; }
+    std::size_t creditCount() const { return credits_.size(); }
+    
+    // Up to limit credits starting at offset; empty past the end
+    std::vector<CreditModel> credits(std::size_t offset, std::size_t limit) const;
+    const SerializedBody& featuresJson() const { return featuresJson_; }
+    const SerializedBody& creditsJson() const { return creditsJson_; }
+    
+    static std::shared_ptr<const ContentSnapshot> current();
+    static void publish(std::shared_ptr<const ContentSnapshot> snapshot);
+    
+private:
+    std::vector<FeatureModel> features_;
+    std::vector<CreditModel> credits_;
+    SerializedBody featuresJson_;
+    SerializedBody creditsJson_;
+};
+
+} // namespace Models
+} // namespace CSPNet
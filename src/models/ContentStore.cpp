@@ -0,0 +1,199 @@
+#include "ContentStore.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <json/json.h>
+#include <cerrno>
+#include <stdexcept>
+#include "../logging/Logger.h"
+
+namespace CSPNet {
+namespace Models {
+
+namespace {
+
+// Reads the whole file into memory. The file is small, and unlike a
+// mapping a copy survives an editor truncating the file while it is parsed.
+std::string readContents(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("cannot open " + path);
+    }
+    std::string contents;
+    char buffer[16 * 1024];
+    for (;;) {
+        const auto count = ::read(fd, buffer, sizeof(buffer));
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count < 0) {
+            ::close(fd);
+            throw std::runtime_error("cannot read " + path);
+        }
+        if (count == 0) {
+            break;
+        }
+        contents.append(buffer, static_cast<std::size_t>(count));
+    }
+    ::close(fd);
+    if (contents.empty()) {
+        throw std::runtime_error(path + " is empty");
+    }
+    return contents;
+}
+
+std::string field(const Json::Value& item, const char* name, bool required) {
+    const auto& value = item[name];
+    if (value.isString()) {
+        return value.asString();
+    }
+    if (required || !value.isNull()) {
+        throw std::runtime_error(std::string("\"") + name + "\" must be a string");
+    }
+    return std::string();
+}
+
+const Json::Value& list(const Json::Value& root, const char* name) {
+    const auto& value = root[name];
+    if (!value.isArray()) {
+        throw std::runtime_error(std::string("\"") + name + "\" must be an array");
+    }
+    return value;
+}
+
+std::string directoryOf(const std::string& path) {
+    const auto slash = path.rfind('/');
+    if (slash == std::string::npos) {
+        return ".";
+    }
+    return slash == 0 ? "/" : path.substr(0, slash);
+}
+
+std::string fileNameOf(const std::string& path) {
+    const auto slash = path.rfind('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+} // namespace
+
+ContentStore::ContentStore(std::string path) : path_(std::move(path)) {
+}
+
+ContentStore::~ContentStore() {
+    stop();
+}
+
+std::shared_ptr<const ContentSnapshot> ContentStore::parse(std::string_view json) {
+    Json::CharReaderBuilder builder;
+    builder["collectComments"] = false;
+    std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+    
+    Json::Value root;
+    std::string errors;
+    if (!reader->parse(json.data(), json.data() + json.size(), &root, &errors)) {
+        throw std::runtime_error(errors);
+    }
+    if (!root.isObject()) {
+        throw std::runtime_error("content root must be an object");
+    }
+    
+    std::vector<FeatureModel> features;
+    for (const auto& item : list(root, "features")) {
+        features.emplace_back(field(item, "title", true), field(item, "description", true),
+                              field(item, "icon", false));
+    }
+    
+    std::vector<CreditModel> credits;
+    for (const auto& item : list(root, "credits")) {
+        credits.emplace_back(field(item, "name", true), field(item, "role", true),
+                             field(item, "avatar", false));
+    }
+    
+    return std::make_shared<const ContentSnapshot>(std::move(features), std::move(credits));
+}
+
+bool ContentStore::load() {
+    std::shared_ptr<const ContentSnapshot> snapshot;
+    try {
+        snapshot = parse(readContents(path_));
+    } catch (const std::exception& e) {
+        CSP_LOG_ERROR("Content: keeping current content, {}: {}", path_, e.what());
+        return false;
+    }
+    
+    ContentSnapshot::publish(snapshot);
+    CSP_LOG_INFO("Content: loaded {} features, {} credits from {}",
+                 snapshot->features().size(), snapshot->credits().size(), path_);
+    return true;
+}
+
+void ContentStore::watch() {
+    if (running_) {
+        return;
+    }
+    
+    // Watch the directory rather than the file: editors and deploy tools
+    // usually replace the file by rename, which would orphan a file watch
+    const int inotifyFd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        CSP_LOG_WARN("Content: inotify unavailable, {} will not be reloaded", path_);
+        return;
+    }
+    if (::inotify_add_watch(inotifyFd, directoryOf(path_).c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+        ::pipe2(wakeFds_, O_CLOEXEC) != 0) {
+        CSP_LOG_WARN("Content: cannot watch {}, it will not be reloaded", path_);
+        ::close(inotifyFd);
+        return;
+    }
+    
+    running_ = true;
+    watcher_ = std::thread(&ContentStore::watchLoop, this, inotifyFd);
+}
+
+void ContentStore::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    
+    const char wake = 0;
+    (void)!::write(wakeFds_[1], &wake, 1);
+    watcher_.join();
+    ::close(wakeFds_[0]);
+    ::close(wakeFds_[1]);
+    wakeFds_[0] = wakeFds_[1] = -1;
+}
+
+void ContentStore::watchLoop(int inotifyFd) {
+    const auto fileName = fileNameOf(path_);
+    alignas(struct inotify_event) char buffer[4096];
+    
+    while (running_) {
+        pollfd fds[2] = {{inotifyFd, POLLIN, 0}, {wakeFds_[0], POLLIN, 0}};
+        if (::poll(fds, 2, -1) < 0 || (fds[1].revents & POLLIN)) {
+            continue;
+        }
+        
+        // Drain everything queued so a burst of writes costs one reload
+        bool changed = false;
+        ssize_t length;
+        while ((length = ::read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+            for (char* p = buffer; p < buffer + length;) {
+                const auto* event = reinterpret_cast<const struct inotify_event*>(p);
+                if (event->len > 0 && fileName == event->name) {
+                    changed = true;
+                }
+                p += sizeof(struct inotify_event) + event->len;
+            }
+        }
+        
+        if (changed && load() && onReload_) {
+            onReload_(ContentSnapshot::current());
+        }
+    }
+    
+    ::close(inotifyFd);
+}
+
+} // namespace Models
+} // namespace CSPNet
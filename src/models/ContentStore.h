@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include "ContentSnapshot.h"
+
+namespace CSPNet {
+namespace Models {
+
+// Loads features and credits from a JSON content file and republishes them
+// whenever the file changes. The file is read and parsed once per
+// change into a fresh ContentSnapshot; sessions keep whichever snapshot they
+// already hold. A file that fails to parse leaves the current content live.
+//
+//   {
+//     "features": [ { "title": "...", "description": "...", "icon": "..." } ],
+//     "credits":  [ { "name": "...", "role": "...", "avatar": "..." } ]
+//   }
+class ContentStore {
+public:
+    using ReloadCallback = std::function<void(const std::shared_ptr<const ContentSnapshot>&)>;
+    
+    explicit ContentStore(std::string path);
+    ~ContentStore();
+    
+    ContentStore(const ContentStore&) = delete;
+    ContentStore& operator=(const ContentStore&) = delete;
+    
+    // Parses and publishes the file; false (and an error logged) on failure
+    bool load();
+    
+    // Reloads on every write or replace of the file until stop() is called
+    void watch();
+    void stop();
+    
+    // Called on the watcher thread after each successful reload
+    void setReloadCallback(ReloadCallback callback) { onReload_ = std::move(callback); }
+    
+    const std::string& path() const { return path_; }
+    
+    // Throws std::runtime_error describing the first problem found
+    static std::shared_ptr<const ContentSnapshot> parse(std::string_view json);
+    
+private:
+    void watchLoop(int inotifyFd);
+    
+    std::string path_;
+    ReloadCallback onReload_;
+    std::thread watcher_;
+    int wakeFds_[2] = {-1, -1};
+    std::atomic<bool> running_{false};
+};
+
+} // namespace Models
+} // namespace CSPNet
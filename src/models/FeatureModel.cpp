@@ -1,9 +1,49 @@
 #include "FeatureModel.h"
+#include "ContentRepository.h"
+#include "ContentSnapshot.h"
 
 namespace CSPNet {
 namespace Models {
 
+namespace {
+
+// Set once at startup, read by every request and session
+std::shared_ptr<const ContentRepository>& currentRepository() {
+    static std::shared_ptr<const ContentRepository> repository = std::make_shared<SnapshotContentRepository>();
+    return repository;
+}
+
+} // namespace
+
 std::vector<FeatureModel> AppData::getFeatures() {
+    return repository()->features();
+}
+
+std::size_t AppData::creditCount() {
+    return repository()->creditCount();
+}
+
+std::vector<CreditModel> AppData::getCredits(std::size_t offset, std::size_t limit) {
+    return repository()->credits(static_cast<std::int64_t>(offset), limit).credits;
+}
+
+CreditPage AppData::getCreditPage(std::int64_t from, std::size_t limit) {
+    return repository()->credits(from, limit);
+}
+
+std::shared_ptr<const ContentRepository> AppData::repository() {
+    return std::atomic_load(&currentRepository());
+}
+
+void AppData::setRepository(std::shared_ptr<const ContentRepository> repository) {
+    std::atomic_store(&currentRepository(), std::move(repository));
+}
+
+std::shared_ptr<const ContentSnapshot> AppData::snapshot() {
+    return ContentSnapshot::current();
+}
+
+std::vector<FeatureModel> AppData::defaultFeatures() {
     return {
         FeatureModel(
             "Modern Architecture", 
@@ -23,7 +63,7 @@ std::vector<FeatureModel> AppData::getFeatures() {
     };
 }
 
-std::vector<CreditModel> AppData::getCredits() {
+std::vector<CreditModel> AppData::defaultCredits() {
     return {
         CreditModel(
             "Zerohexer", 
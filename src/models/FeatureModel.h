@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -12,6 +14,11 @@ struct FeatureModel {
     
     FeatureModel(const std::string& t, const std::string& d, const std::string& i = "")
         : title(t), description(d), icon(i) {}
+    
+    bool operator==(const FeatureModel& other) const {
+        return title == other.title && description == other.description && icon == other.icon;
+    }
+    bool operator!=(const FeatureModel& other) const { return !(*this == other); }
 };
 
 struct CreditModel {
@@ -21,12 +28,37 @@ struct CreditModel {
     
     CreditModel(const std::string& n, const std::string& r, const std::string& a = "")
         : name(n), role(r), avatar(a) {}
+    
+    bool operator==(const CreditModel& other) const {
+        return name == other.name && role == other.role && avatar == other.avatar;
+    }
+    bool operator!=(const CreditModel& other) const { return !(*this == other); }
 };
 
+class ContentSnapshot;
+class ContentRepository;
+struct CreditPage;
+
 class AppData {
 public:
+    // Copy of the currently published features
     static std::vector<FeatureModel> getFeatures();
-    static std::vector<CreditModel> getCredits();
+    
+    // Paged access for views that never hold the whole list
+    static std::size_t creditCount();
+    static std::vector<CreditModel> getCredits(std::size_t offset, std::size_t limit);
+    static CreditPage getCreditPage(std::int64_t from, std::size_t limit);
+    
+    // Where the above read from; the published ContentSnapshot by default
+    static std::shared_ptr<const ContentRepository> repository();
+    static void setRepository(std::shared_ptr<const ContentRepository> repository);
+    
+    // Current content without copying; see ContentSnapshot
+    static std::shared_ptr<const ContentSnapshot> snapshot();
+    
+    // Built-in content used until something else is published
+    static std::vector<FeatureModel> defaultFeatures();
+    static std::vector<CreditModel> defaultCredits();
 };
 
 } // namespace Models
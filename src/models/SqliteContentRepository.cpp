@@ -0,0 +1,246 @@
+#include "SqliteContentRepository.h"
+#include <sqlite3.h>
+#include <atomic>
+#include <stdexcept>
+#include <unordered_map>
+#include "../logging/Logger.h"
+#include "../metrics/Metrics.h"
+
+namespace CSPNet {
+namespace Models {
+
+namespace {
+
+// Statements are cached by the address of these strings
+constexpr const char* schemaSql =
+    "CREATE TABLE IF NOT EXISTS features ("
+    " position INTEGER PRIMARY KEY, title TEXT NOT NULL, description TEXT NOT NULL,"
+    " icon TEXT NOT NULL DEFAULT '');"
+    "CREATE TABLE IF NOT EXISTS credits ("
+    " position INTEGER PRIMARY KEY, name TEXT NOT NULL, role TEXT NOT NULL,"
+    " avatar TEXT NOT NULL DEFAULT '');";
+constexpr const char* selectFeaturesSql = "SELECT title, description, icon FROM features ORDER BY position";
+constexpr const char* creditCountSql = "SELECT coalesce(max(position) + 1, 0) FROM credits";
+constexpr const char* selectCreditsSql =
+    "SELECT position, name, role, avatar FROM credits WHERE position >= ?1 ORDER BY position LIMIT ?2";
+constexpr const char* deleteFeaturesSql = "DELETE FROM features";
+constexpr const char* deleteCreditsSql = "DELETE FROM credits";
+constexpr const char* insertFeatureSql =
+    "INSERT INTO features (position, title, description, icon) VALUES (?1, ?2, ?3, ?4)";
+constexpr const char* insertCreditSql =
+    "INSERT INTO credits (position, name, role, avatar) VALUES (?1, ?2, ?3, ?4)";
+
+// Tells repositories apart in the per-thread connection maps; never reused
+std::atomic<std::uint64_t> nextRepositoryId{1};
+
+std::string columnText(sqlite3_stmt* statement, int column) {
+    const auto text = sqlite3_column_text(statement, column);
+    return text ? std::string(reinterpret_cast<const char*>(text),
+                              static_cast<std::size_t>(sqlite3_column_bytes(statement, column)))
+                : std::string();
+}
+
+} // namespace
+
+// One sqlite3 handle and its prepared statements, used by one thread at a time
+class SqliteContentRepository::Connection {
+public:
+    Connection(const std::string& path, int flags) {
+        // Each connection has a single user, so SQLite's own locking is off
+        if (sqlite3_open_v2(path.c_str(), &db_, flags | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK) {
+            const std::string message = db_ ? sqlite3_errmsg(db_) : "out of memory";
+            sqlite3_close(db_);
+            throw std::runtime_error("cannot open " + path + ": " + message);
+        }
+        sqlite3_busy_timeout(db_, 1000);
+    }
+    
+    ~Connection() {
+        for (auto& entry : statements_) {
+            sqlite3_finalize(entry.second);
+        }
+        sqlite3_close(db_);
+    }
+    
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+    
+    void exec(const char* sql) {
+        char* error = nullptr;
+        if (sqlite3_exec(db_, sql, nullptr, nullptr, &error) != SQLITE_OK) {
+            const std::string message = error ? error : sqlite3_errmsg(db_);
+            sqlite3_free(error);
+            throw std::runtime_error(message);
+        }
+    }
+    
+    // Resets the statement and its bindings when the caller is done with it
+    class Statement {
+    public:
+        explicit Statement(sqlite3_stmt* statement) : statement_(statement) {}
+        ~Statement() {
+            sqlite3_reset(statement_);
+            sqlite3_clear_bindings(statement_);
+        }
+        
+        Statement(const Statement&) = delete;
+        Statement& operator=(const Statement&) = delete;
+        
+        sqlite3_stmt* get() const { return statement_; }
+        
+        void bind(int index, std::int64_t value) { sqlite3_bind_int64(statement_, index, value); }
+        void bind(int index, const std::string& value) {
+            sqlite3_bind_text(statement_, index, value.data(), static_cast<int>(value.size()), SQLITE_STATIC);
+        }
+        
+        // true while there is a row; throws on errors
+        bool step() {
+            const auto result = sqlite3_step(statement_);
+            if (result == SQLITE_ROW) {
+                return true;
+            }
+            if (result != SQLITE_DONE) {
+                throw std::runtime_error(sqlite3_errmsg(sqlite3_db_handle(statement_)));
+            }
+            return false;
+        }
+    
+    private:
+        sqlite3_stmt* statement_;
+    };
+    
+    // Prepared once per connection, then reused
+    Statement prepare(const char* sql) {
+        auto it = statements_.find(sql);
+        if (it == statements_.end()) {
+            sqlite3_stmt* statement = nullptr;
+            if (sqlite3_prepare_v3(db_, sql, -1, SQLITE_PREPARE_PERSISTENT, &statement, nullptr) != SQLITE_OK) {
+                throw std::runtime_error(sqlite3_errmsg(db_));
+            }
+            it = statements_.emplace(sql, statement).first;
+        }
+        return Statement(it->second);
+    }
+    
+private:
+    sqlite3* db_ = nullptr;
+    std::unordered_map<const char*, sqlite3_stmt*> statements_;
+};
+
+SqliteContentRepository::SqliteContentRepository(std::string path)
+    : path_(std::move(path)), id_(nextRepositoryId.fetch_add(1, std::memory_order_relaxed)) {
+    writer_ = std::make_unique<Connection>(path_, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+    
+    // WAL is a property of the file; it lets reads run beside the writer
+    writer_->exec("PRAGMA journal_mode=WAL;");
+    writer_->exec("PRAGMA synchronous=NORMAL;");
+    writer_->exec(schemaSql);
+    CSP_LOG_INFO("Content: SQLite repository {} opened", path_);
+}
+
+SqliteContentRepository::~SqliteContentRepository() = default;
+
+SqliteContentRepository::Connection& SqliteContentRepository::reader() const {
+    // Pointers into readers_, by repository; a destroyed repository's id
+    // is never looked up again
+    thread_local std::unordered_map<std::uint64_t, Connection*> connections;
+    auto it = connections.find(id_);
+    if (it != connections.end()) {
+        return *it->second;
+    }
+    
+    auto connection = std::make_unique<Connection>(path_, SQLITE_OPEN_READONLY);
+    auto raw = connection.get();
+    {
+        std::lock_guard<std::mutex> lock(readersMutex_);
+        readers_.push_back(std::move(connection));
+    }
+    connections.emplace(id_, raw);
+    return *raw;
+}
+
+std::vector<FeatureModel> SqliteContentRepository::features() const {
+    CSP_TIME_SCOPE("content_db_features");
+    std::vector<FeatureModel> features;
+    try {
+        auto statement = reader().prepare(selectFeaturesSql);
+        while (statement.step()) {
+            features.emplace_back(columnText(statement.get(), 0), columnText(statement.get(), 1),
+                                  columnText(statement.get(), 2));
+        }
+    } catch (const std::exception& e) {
+        CSP_LOG_WARN("Content: reading features from {} failed: {}", path_, e.what());
+        features.clear();
+    }
+    return features;
+}
+
+std::size_t SqliteContentRepository::creditCount() const {
+    try {
+        auto statement = reader().prepare(creditCountSql);
+        return statement.step() ? static_cast<std::size_t>(sqlite3_column_int64(statement.get(), 0)) : 0;
+    } catch (const std::exception& e) {
+        CSP_LOG_WARN("Content: counting credits in {} failed: {}", path_, e.what());
+        return 0;
+    }
+}
+
+CreditPage SqliteContentRepository::credits(std::int64_t from, std::size_t limit) const {
+    CSP_TIME_SCOPE("content_db_credits");
+    CreditPage page;
+    try {
+        // One row past the page tells whether another page follows
+        auto statement = reader().prepare(selectCreditsSql);
+        statement.bind(1, from < 0 ? 0 : from);
+        statement.bind(2, static_cast<std::int64_t>(limit) + 1);
+        while (statement.step()) {
+            const auto position = sqlite3_column_int64(statement.get(), 0);
+            if (page.credits.size() == limit) {
+                page.next = position;
+                break;
+            }
+            page.credits.emplace_back(columnText(statement.get(), 1), columnText(statement.get(), 2),
+                                      columnText(statement.get(), 3));
+        }
+    } catch (const std::exception& e) {
+        CSP_LOG_WARN("Content: reading credits from {} failed: {}", path_, e.what());
+        page = CreditPage();
+    }
+    return page;
+}
+
+void SqliteContentRepository::replaceContent(const std::vector<FeatureModel>& features,
+                                             const std::vector<CreditModel>& credits) {
+    CSP_TIME_SCOPE("content_db_replace");
+    std::lock_guard<std::mutex> lock(writerMutex_);
+    writer_->exec("BEGIN IMMEDIATE;");
+    try {
+        writer_->prepare(deleteFeaturesSql).step();
+        writer_->prepare(deleteCreditsSql).step();
+        
+        for (std::size_t i = 0; i < features.size(); ++i) {
+            auto insert = writer_->prepare(insertFeatureSql);
+            insert.bind(1, static_cast<std::int64_t>(i));
+            insert.bind(2, features[i].title);
+            insert.bind(3, features[i].description);
+            insert.bind(4, features[i].icon);
+            insert.step();
+        }
+        for (std::size_t i = 0; i < credits.size(); ++i) {
+            auto insert = writer_->prepare(insertCreditSql);
+            insert.bind(1, static_cast<std::int64_t>(i));
+            insert.bind(2, credits[i].name);
+            insert.bind(3, credits[i].role);
+            insert.bind(4, credits[i].avatar);
+            insert.step();
+        }
+        writer_->exec("COMMIT;");
+    } catch (...) {
+        writer_->exec("ROLLBACK;");
+        throw;
+    }
+    CSP_LOG_INFO("Content: {} features and {} credits written to {}", features.size(), credits.size(), path_);
+}
+
+} // namespace Models
+} // namespace CSPNet
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ContentRepository.h"
+
+namespace CSPNet {
+namespace Models {
+
+// Features and credits in an SQLite database in WAL mode, so readers never
+// wait for the writer or for each other. Every thread that reads gets its
+// own read-only connection on first use, with its prepared statements
+// cached for the life of the repository. Credits are read a keyset page at a
+// time; nothing loads the whole list.
+//
+//   features(position INTEGER PRIMARY KEY, title, description, icon)
+//   credits(position INTEGER PRIMARY KEY, name, role, avatar)
+//
+// Positions are dense and start at 0 (replaceContent() keeps them so).
+class SqliteContentRepository : public ContentRepository {
+public:
+    // Creates the file and schema if needed; throws std::runtime_error if
+    // the database cannot be opened
+    explicit SqliteContentRepository(std::string path);
+    ~SqliteContentRepository() override;
+    
+    SqliteContentRepository(const SqliteContentRepository&) = delete;
+    SqliteContentRepository& operator=(const SqliteContentRepository&) = delete;
+    
+    // Read failures are logged and read as empty
+    std::vector<FeatureModel> features() const override;
+    std::size_t creditCount() const override;
+    CreditPage credits(std::int64_t from, std::size_t limit) const override;
+    bool inSnapshot() const override { return false; }
+    
+    // Replaces all content in one transaction; readers see the old or the
+    // new set, never a mix. Throws std::runtime_error on failure.
+    void replaceContent(const std::vector<FeatureModel>& features, const std::vector<CreditModel>& credits);
+    
+    const std::string& path() const { return path_; }
+    
+private:
+    class Connection;
+    
+    Connection& reader() const;
+    
+    std::string path_;
+    std::uint64_t id_;
+    std::unique_ptr<Connection> writer_;
+    std::mutex writerMutex_;
+    
+    // Read connections, one per thread that has read; closed with the repository
+    mutable std::mutex readersMutex_;
+    mutable std::vector<std::unique_ptr<Connection>> readers_;
+};
+
+} // namespace Models
+} // namespace CSPNet
@@ -1,20 +1,64 @@
 #pragma once
-#include <Wt/WApplication.h>
+#include "StyleSheetCompiler.h"
 
 namespace CSPNet {
 namespace Styles {
 
+// Apple-specific navigation styling. Card glassmorphism and hover
+// effects are defined once in DesignSystem::componentStyles.
 class AppleTheme {
 public:
-    static void setupAppleDesignSystem();
-    static void setupTypography();
-    static void setupColors();
-    static void setupEffects();
-    static void setupAnimations();
+    static constexpr CssRule typography[] = {
+        // Apple Navigation Bar
+        { ".nav-bar",
+          "background: rgba(29, 29, 31, 0.8); "
+          "backdrop-filter: saturate(180%) blur(20px); "
+          "-webkit-backdrop-filter: saturate(180%) blur(20px); "
+          "border-bottom: 0.5px solid rgba(255, 255, 255, 0.1); "
+          "height: 52px; "
+          "position: sticky; "
+          "top: 0; "
+          "z-index: 9999;" },
+        { ".nav-container",
+          "max-width: 1200px; "
+          "margin: 0 auto; "
+          "height: 52px; "
+          "display: flex; "
+          "align-items: center; "
+          "justify-content: space-between; "
+          "padding: 0 20px;" },
+        { ".nav-logo",
+          "font-size: 21px; "
+          "font-weight: 600; "
+          "color: #f5f5f7; "
+          "letter-spacing: -0.022em;" },
+        { ".nav-menu",
+          "display: flex; "
+          "gap: 32px; "
+          "align-items: center;" },
+    };
     
-private:
-    static Wt::WCssStyleSheet& getStyleSheet();
+    static constexpr CssRule colors[] = {
+        { ".nav-item",
+          "color: #f5f5f7; "
+          "font-size: 17px; "
+          "font-weight: 400; "
+          "text-decoration: none; "
+          "padding: 8px 16px; "
+          "border-radius: 20px; "
+          "transition: all 0.3s ease; "
+          "cursor: pointer; "
+          "opacity: 0.8;" },
+        { ".nav-item:hover",
+          "opacity: 1; "
+          "background: rgba(255, 255, 255, 0.1); "
+          "transform: translateY(-1px);" },
+        { ".nav-item.active",
+          "opacity: 1; "
+          "background: rgba(255, 255, 255, 0.15); "
+          "color: #ffffff;" },
+    };
 };
 
 } // namespace Styles
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
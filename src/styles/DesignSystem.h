@@ -1,19 +1,246 @@
 #pragma once
-#include <Wt/WApplication.h>
+#include "StyleSheetCompiler.h"
 
 namespace CSPNet {
 namespace Styles {
 
+// Core design system rules, compiled into the theme at build time
 class DesignSystem {
 public:
-    static void setupGlobalStyles();
-    static void setupComponentStyles();
-    static void setupLayoutStyles();
-    static void setupResponsiveStyles();
+    static constexpr CssRule globalStyles[] = {
+        // Base reset and typography
+        { "*",
+          "margin: 0; "
+          "padding: 0; "
+          "box-sizing: border-box;" },
+        { "html, body",
+          "font-family: -apple-system, BlinkMacSystemFont, system-ui, sans-serif; "
+          "-webkit-font-smoothing: antialiased; "
+          "-moz-osx-font-smoothing: grayscale; "
+          "background: #000000; "
+          "color: #f5f5f7; "
+          "line-height: 1.47; "
+          "overflow-x: hidden; "
+          "min-height: 100vh;" },
+        // App container; stacks the nav bar above the content stack
+        { ".app-container",
+          "display: flex; "
+          "flex-direction: column; "
+          "min-height: 100vh; "
+          "background: linear-gradient(135deg, #000000 0%, #1d1d1f 50%, #000000 100%);" },
+    };
     
-private:
-    static Wt::WCssStyleSheet& getStyleSheet();
+    static constexpr CssRule componentStyles[] = {
+        // Content stack
+        { ".content-stack",
+          "flex: 1;" },
+        // Page styles
+        { ".page",
+          "min-height: calc(100vh - 52px); "
+          "padding: 80px 20px; "
+          "overflow: visible;" },
+        { ".page-container",
+          "max-width: 1200px; "
+          "margin: 0 auto; "
+          "text-align: center; "
+          "overflow: visible; "
+          "position: relative;" },
+        // Hero section
+        { ".hero",
+          "margin-bottom: 80px;" },
+        { ".hero-title",
+          "display: block; "
+          "font-size: clamp(48px, 8vw, 96px); "
+          "font-weight: 700; "
+          "letter-spacing: -0.055em; "
+          "margin-bottom: 24px; "
+          "background: linear-gradient(135deg, #ffffff 0%, #f5f5f7 25%, #d1d1d6 75%, #a1a1a6 100%); "
+          "-webkit-background-clip: text; "
+          "-webkit-text-fill-color: transparent; "
+          "background-clip: text; "
+          "line-height: 1.05;" },
+        { ".hero-subtitle",
+          "display: block; "
+          "font-size: clamp(21px, 3vw, 28px); "
+          "font-weight: 400; "
+          "color: rgba(245, 245, 247, 0.7); "
+          "margin-bottom: 48px; "
+          "letter-spacing: -0.022em; "
+          "line-height: 1.14;" },
+        // Feature cards
+        { ".feature-card",
+          "background: rgba(255, 255, 255, 0.05); "
+          "backdrop-filter: blur(20px); "
+          "-webkit-backdrop-filter: blur(20px); "
+          "border: 1px solid rgba(255, 255, 255, 0.1); "
+          "border-radius: 20px; "
+          "padding: 40px 32px; "
+          "transition: all 0.4s ease; "
+          "position: relative; "
+          "overflow: hidden; "
+          "z-index: 1;" },
+        { ".feature-card::before",
+          "content: ''; "
+          "position: absolute; "
+          "top: 0; "
+          "left: 0; "
+          "right: 0; "
+          "height: 1px; "
+          "background: linear-gradient(90deg, transparent, rgba(255, 255, 255, 0.4), transparent);" },
+        { ".feature-card:hover",
+          "transform: translateY(-8px); "
+          "background: rgba(255, 255, 255, 0.08); "
+          "border-color: rgba(255, 255, 255, 0.2); "
+          "box-shadow: 0 20px 40px rgba(0, 0, 0, 0.3); "
+          "z-index: 10;" },
+        { ".feature-title",
+          "display: block; "
+          "font-size: 22px; "
+          "font-weight: 600; "
+          "color: #f5f5f7; "
+          "margin-bottom: 16px; "
+          "letter-spacing: -0.022em;" },
+        { ".feature-desc",
+          "display: block; "
+          "font-size: 17px; "
+          "color: rgba(245, 245, 247, 0.7); "
+          "line-height: 1.47; "
+          "letter-spacing: -0.022em;" },
+        // Credit cards
+        { ".credit-card",
+          "background: rgba(255, 255, 255, 0.05); "
+          "backdrop-filter: blur(20px); "
+          "-webkit-backdrop-filter: blur(20px); "
+          "border: 1px solid rgba(255, 255, 255, 0.1); "
+          "border-radius: 24px; "
+          "padding: 60px 40px; "
+          "transition: all 0.4s ease; "
+          "text-align: center; "
+          "position: relative; "
+          "z-index: 1;" },
+        { ".credit-card:hover",
+          "transform: translateY(-12px); "
+          "background: rgba(255, 255, 255, 0.08); "
+          "border-color: rgba(255, 255, 255, 0.2); "
+          "box-shadow: 0 25px 50px rgba(0, 0, 0, 0.4); "
+          "z-index: 10;" },
+        { ".credit-name",
+          "display: block; "
+          "font-size: 32px; "
+          "font-weight: 600; "
+          "color: #f5f5f7; "
+          "margin-bottom: 16px; "
+          "letter-spacing: -0.022em;" },
+        { ".credit-role",
+          "display: block; "
+          "font-size: 18px; "
+          "color: rgba(245, 245, 247, 0.7); "
+          "font-weight: 400; "
+          "letter-spacing: -0.022em;" },
+        // Call-to-action button; hover is resolved by the browser
+        { ".cta-section",
+          "margin-top: 60px; "
+          "margin-bottom: 40px; "
+          "text-align: center; "
+          "padding: 40px; "
+          "overflow: visible;" },
+        { "button.cta-button",
+          "background: linear-gradient(135deg, #007aff 0%, #0056cc 100%); "
+          "color: #ffffff; "
+          "border: none; "
+          "border-radius: 50px; "
+          "padding: 20px 40px; "
+          "font-family: -apple-system, BlinkMacSystemFont, system-ui, sans-serif; "
+          "font-size: 18px; "
+          "font-weight: 600; "
+          "letter-spacing: -0.01em; "
+          "cursor: pointer; "
+          "transition: all 0.4s cubic-bezier(0.175, 0.885, 0.32, 1.275); "
+          "box-shadow: 0 8px 30px rgba(0, 122, 255, 0.4), 0 4px 15px rgba(0, 122, 255, 0.2); "
+          "backdrop-filter: blur(10px); "
+          "position: relative; "
+          "overflow: hidden; "
+          "text-shadow: 0 1px 2px rgba(0, 0, 0, 0.1); "
+          "transform: translateY(0) scale(1);" },
+        { "button.cta-button:hover, button.cta-button:focus-visible",
+          "background: linear-gradient(135deg, #0084ff 0%, #0066ff 100%); "
+          "box-shadow: 0 12px 40px rgba(0, 122, 255, 0.6), 0 8px 25px rgba(0, 122, 255, 0.3); "
+          "transform: translateY(-3px) scale(1.02);" },
+    };
+    
+    static constexpr CssRule layoutStyles[] = {
+        // Feature grid
+        { ".features",
+          "display: grid; "
+          "grid-template-columns: repeat(auto-fit, minmax(300px, 1fr)); "
+          "gap: 24px; "
+          "margin: 60px 0; "
+          "padding: 20px 0 40px 0; "
+          "overflow: visible; "
+          "position: relative;" },
+        // Credits grid
+        { ".credits-grid",
+          "display: grid; "
+          "grid-template-columns: repeat(auto-fit, minmax(350px, 1fr)); "
+          "gap: 40px; "
+          "margin-top: 60px; "
+          "padding: 30px 0 50px 0; "
+          "overflow: visible; "
+          "position: relative;" },
+        // Virtualized credits grid; row pitch is VirtualCreditsGrid::rowHeight
+        { ".credits-viewport",
+          "height: 70vh; "
+          "margin-top: 60px; "
+          "overflow-y: auto; "
+          "position: relative;" },
+        { ".credits-spacer",
+          "position: relative;" },
+        { ".credits-window",
+          "left: 0; "
+          "right: 0; "
+          "display: grid; "
+          "gap: 40px; "
+          "padding-top: 12px;" },
+        { ".credits-window.columns-1", "grid-template-columns: minmax(0, 1fr);" },
+        { ".credits-window.columns-2", "grid-template-columns: repeat(2, minmax(0, 1fr));" },
+        { ".credits-window.columns-3", "grid-template-columns: repeat(3, minmax(0, 1fr));" },
+        { ".credits-window.columns-4", "grid-template-columns: repeat(4, minmax(0, 1fr));" },
+        { ".credits-window .credit-card",
+          "height: 220px; "
+          "box-sizing: border-box; "
+          "padding: 48px 32px; "
+          "overflow: hidden;" },
+        // Tech stack
+        { ".tech-stack",
+          "margin-top: 80px; "
+          "padding-top: 60px; "
+          "border-top: 1px solid rgba(255, 255, 255, 0.1);" },
+        { ".tech-label",
+          "display: block; "
+          "font-size: 15px; "
+          "color: #a1a1a6; "
+          "margin-bottom: 20px; "
+          "text-transform: uppercase; "
+          "letter-spacing: 2px; "
+          "font-weight: 500;" },
+        { ".tech-items",
+          "display: block; "
+          "font-size: 18px; "
+          "color: #d1d1d6; "
+          "font-weight: 400; "
+          "letter-spacing: -0.022em;" },
+    };
+    
+    static constexpr CssRule responsiveStyles[] = {
+        { "@media (max-width: 768px)",
+          ".nav-container { padding: 0 16px; } "
+          ".nav-menu { gap: 20px; } "
+          ".page { padding: 40px 16px; } "
+          ".features { grid-template-columns: 1fr; } "
+          ".credits-grid { grid-template-columns: 1fr; } "
+          ".feature-card, .credit-card { padding: 32px 24px; }" },
+    };
 };
 
 } // namespace Styles
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
@@ -0,0 +1,86 @@
+#pragma once
+#include "StyleSheetCompiler.h"
+
+namespace CSPNet {
+namespace Styles {
+
+// A declaration block that used to be set as a widget's inline style. Its
+// class name is derived from the declarations, so it stays the same across
+// builds as long as the block does, and the block is emitted once into the
+// theme instead of being stored and sent for every widget.
+class InlineStyle {
+public:
+    explicit constexpr InlineStyle(std::string_view declarations)
+        : declarations_(declarations), selector_(selectorFor(declarations)) {}
+    
+    // e.g. "s3f9a1c", for setStyleClass()/addStyleClass()
+    constexpr const char* className() const { return selector_.data + 1; }
+    constexpr CssRule rule() const { return { selector_.view(), declarations_ }; }
+    
+private:
+    static constexpr FixedString<7> selectorFor(std::string_view declarations) {
+        const auto digest = hexDigest(declarations);
+        FixedString<7> selector{};
+        selector.data[0] = '.';
+        selector.data[1] = 's';
+        for (std::size_t i = 0; i < 5; ++i) {
+            selector.data[i + 2] = digest.data[i];
+        }
+        return selector;
+    }
+    
+    std::string_view declarations_;
+    FixedString<7> selector_;
+};
+
+// Every inline style used by the pages. A block is registered here once and
+// shared by all widgets that use it; registering the same block twice, or
+// two blocks whose names collide, fails the theme's duplicate check.
+class InlineStyles {
+public:
+    static constexpr InlineStyle pageBackground{
+        "min-height: calc(100vh - 52px); "
+        "padding: 80px 20px; "
+        "overflow: visible; "
+        "background: linear-gradient(135deg, #000000 0%, #1d1d1f 50%, #000000 100%);" };
+    static constexpr InlineStyle pageContent{
+        "max-width: 1200px; "
+        "margin: 0 auto; "
+        "text-align: center; "
+        "overflow: visible;" };
+    static constexpr InlineStyle heroSpacing{
+        "margin-bottom: 80px;" };
+    static constexpr InlineStyle heroTitle{
+        "display: block; "
+        "font-size: clamp(48px, 8vw, 96px); "
+        "font-weight: 700; "
+        "letter-spacing: -0.055em; "
+        "margin-bottom: 24px; "
+        "background: linear-gradient(135deg, #ffffff 0%, #f5f5f7 25%, #d1d1d6 75%, #a1a1a6 100%); "
+        "-webkit-background-clip: text; "
+        "-webkit-text-fill-color: transparent; "
+        "background-clip: text; "
+        "line-height: 1.05; "
+        "font-family: -apple-system, BlinkMacSystemFont, system-ui, sans-serif;" };
+    static constexpr InlineStyle heroSubtitle{
+        "display: block; "
+        "font-size: clamp(21px, 3vw, 28px); "
+        "font-weight: 400; "
+        "color: rgba(245, 245, 247, 0.7); "
+        "margin-bottom: 48px; "
+        "letter-spacing: -0.022em; "
+        "line-height: 1.14; "
+        "font-family: -apple-system, BlinkMacSystemFont, system-ui, sans-serif;" };
+    
+    // Compiled into the theme after the design system tables
+    static constexpr CssRule rules[] = {
+        pageBackground.rule(),
+        pageContent.rule(),
+        heroSpacing.rule(),
+        heroTitle.rule(),
+        heroSubtitle.rule(),
+    };
+};
+
+} // namespace Styles
+} // namespace CSPNet
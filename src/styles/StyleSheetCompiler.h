@@ -0,0 +1,222 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include "../utils/ContentHash.h"
+
+namespace CSPNet {
+namespace Styles {
+
+// A single CSS rule; tables of these are declared constexpr by the theme
+struct CssRule {
+    std::string_view selector;
+    std::string_view declarations;
+};
+
+// Fixed-size, NUL-terminated character buffer produced at compile time
+template <std::size_t N>
+struct FixedString {
+    char data[N + 1] = {};
+    
+    constexpr std::size_t size() const { return N; }
+    constexpr std::string_view view() const { return std::string_view(data, N); }
+};
+
+// Appends characters to a buffer, or only counts them when the buffer is null
+class CssWriter {
+public:
+    constexpr explicit CssWriter(char* out) : out_(out), size_(0) {}
+    
+    constexpr void put(char c) {
+        if (out_) {
+            out_[size_] = c;
+        }
+        ++size_;
+    }
+    
+    constexpr void append(std::string_view text) {
+        for (char c : text) {
+            put(c);
+        }
+    }
+    
+    constexpr std::size_t size() const { return size_; }
+    
+private:
+    char* out_;
+    std::size_t size_;
+};
+
+// Strips whitespace that CSS does not need and drops the last ';' in a block.
+// Spaces before ':' are kept in selectors, where ".a :hover" and ".a:hover"
+// differ, and quoted strings are copied verbatim, escapes included.
+class CssMinifier {
+public:
+    constexpr explicit CssMinifier(CssWriter& out)
+        : out_(out), last_('{'), quote_('\0'), escaped_(false), pendingSpace_(false),
+          pendingSemicolon_(false), preludeStart_(true), atRule_(false), depth_(0), ruleDepth_(0) {}
+    
+    constexpr void append(std::string_view text) {
+        for (char c : text) {
+            put(c);
+        }
+    }
+    
+    constexpr void put(char c) {
+        if (quote_) {
+            out_.put(c);
+            if (escaped_) {
+                escaped_ = false;
+            } else if (c == '\\') {
+                escaped_ = true;
+            } else if (c == quote_) {
+                quote_ = '\0';
+            }
+            return;
+        }
+        if (c == ' ' || c == '\n' || c == '\t' || c == '\r') {
+            pendingSpace_ = true;
+            return;
+        }
+        if (c == ';') {
+            pendingSemicolon_ = true;
+            pendingSpace_ = false;
+            preludeStart_ = inSelector();
+            last_ = ';';
+            return;
+        }
+        if (pendingSemicolon_ && c != '}') {
+            out_.put(';');
+        }
+        const bool keepSpace = !isSeparator(c) || (c == ':' && inSelector());
+        if (pendingSpace_ && !isSeparator(last_) && keepSpace) {
+            out_.put(' ');
+        }
+        out_.put(c);
+        last_ = c;
+        track(c);
+        pendingSpace_ = false;
+        pendingSemicolon_ = false;
+    }
+    
+private:
+    static constexpr bool isSeparator(char c) {
+        return c == '{' || c == '}' || c == ';' || c == ',' || c == ':';
+    }
+    
+    // Outside declaration blocks; at-rule blocks such as @media hold rules
+    constexpr bool inSelector() const { return depth_ == ruleDepth_; }
+    
+    constexpr void track(char c) {
+        if (preludeStart_ && inSelector()) {
+            atRule_ = c == '@';
+            preludeStart_ = false;
+        }
+        if (c == '{') {
+            if (inSelector() && atRule_) {
+                ++ruleDepth_;
+            }
+            ++depth_;
+            preludeStart_ = true;
+            atRule_ = false;
+        } else if (c == '}') {
+            if (depth_ > 0) {
+                --depth_;
+            }
+            if (ruleDepth_ > depth_) {
+                ruleDepth_ = depth_;
+            }
+            preludeStart_ = true;
+        } else if (c == '"' || c == '\'') {
+            quote_ = c;
+        }
+    }
+    
+    CssWriter& out_;
+    char last_;
+    char quote_;
+    bool escaped_;
+    bool pendingSpace_;
+    bool pendingSemicolon_;
+    bool preludeStart_;
+    bool atRule_;
+    int depth_;
+    int ruleDepth_;
+};
+
+template <std::size_t N>
+constexpr void writeRules(CssWriter& out, const CssRule (&rules)[N]) {
+    for (const auto& rule : rules) {
+        out.append(rule.selector);
+        out.append(" { ");
+        out.append(rule.declarations);
+        out.append(" }\n");
+    }
+}
+
+template <std::size_t N>
+constexpr void writeMinifiedRules(CssMinifier& out, const CssRule (&rules)[N]) {
+    for (const auto& rule : rules) {
+        out.append(rule.selector);
+        out.put('{');
+        out.append(rule.declarations);
+        out.put('}');
+    }
+}
+
+// Every selector may be defined once across all tables of a theme
+template <std::size_t N, std::size_t M>
+constexpr bool hasSharedSelector(const CssRule (&lhs)[N], const CssRule (&rhs)[M], bool sameTable) {
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = sameTable ? i + 1 : 0; j < M; ++j) {
+            if (lhs[i].selector == rhs[j].selector) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <std::size_t N, std::size_t M>
+constexpr bool hasSharedSelector(const CssRule (&lhs)[N], const CssRule (&rhs)[M]) {
+    return hasSharedSelector(lhs, rhs, static_cast<const void*>(lhs) == static_cast<const void*>(rhs));
+}
+
+template <typename First, typename... Rest>
+constexpr bool hasDuplicateSelectors(const First& first, const Rest&... rest) {
+    bool duplicate = hasSharedSelector(first, first);
+    ((duplicate = duplicate || hasSharedSelector(first, rest)), ...);
+    if constexpr (sizeof...(Rest) > 0) {
+        duplicate = duplicate || hasDuplicateSelectors(rest...);
+    }
+    return duplicate;
+}
+
+// Runs an emitter against a counting writer to size the output buffer
+template <typename Emit>
+constexpr std::size_t measure(Emit emit) {
+    CssWriter counter(nullptr);
+    emit(counter);
+    return counter.size();
+}
+
+template <std::size_t N, typename Emit>
+constexpr FixedString<N> materialize(Emit emit) {
+    FixedString<N> text{};
+    CssWriter writer(text.data);
+    emit(writer);
+    return text;
+}
+
+constexpr FixedString<16> hexDigest(std::string_view data) {
+    constexpr char digits[] = "0123456789abcdef";
+    FixedString<16> hex{};
+    auto hash = Utils::contentHash(data);
+    for (int i = 15; i >= 0; --i) {
+        hex.data[i] = digits[hash & 0xf];
+        hash >>= 4;
+    }
+    return hex;
+}
+
+} // namespace Styles
+} // namespace CSPNet
@@ -0,0 +1,91 @@
+#include "ThemeStyleSheet.h"
+#include "StyleSheetCompiler.h"
+#include "DesignSystem.h"
+#include "AppleTheme.h"
+#include "InlineStyles.h"
+
+namespace CSPNet {
+namespace Styles {
+
+namespace {
+
+static_assert(!hasDuplicateSelectors(DesignSystem::globalStyles,
+                                     DesignSystem::componentStyles,
+                                     DesignSystem::layoutStyles,
+                                     DesignSystem::responsiveStyles,
+                                     AppleTheme::typography,
+                                     AppleTheme::colors,
+                                     InlineStyles::rules),
+              "A CSS selector is defined more than once in the theme rule tables");
+
+// Minifier cases the theme tables do not exercise
+constexpr bool minifiesTo(std::string_view css, std::string_view expected) {
+    char buffer[128] = {};
+    CssWriter writer(buffer);
+    CssMinifier minifier(writer);
+    minifier.append(css);
+    return std::string_view(buffer, writer.size()) == expected;
+}
+
+static_assert(minifiesTo(".a :hover { color: red; }", ".a :hover{color:red}"),
+              "A space before ':' in a selector selects descendants and must be kept");
+static_assert(minifiesTo("@media (max-width: 768px) { .a :first-child { top : 0; } }",
+                         "@media (max-width:768px){.a :first-child{top:0}}"),
+              "Selectors inside @media keep their space before ':'");
+static_assert(minifiesTo("a::after { content: \"\\\" ; \" ; }", "a::after{content:\"\\\" ; \"}"),
+              "An escaped quote does not end a string");
+
+// Same order the rules were previously added to each session
+constexpr auto emitTheme = [](CssWriter& out) {
+    writeRules(out, DesignSystem::globalStyles);
+    writeRules(out, DesignSystem::componentStyles);
+    writeRules(out, DesignSystem::layoutStyles);
+    writeRules(out, DesignSystem::responsiveStyles);
+    writeRules(out, AppleTheme::typography);
+    writeRules(out, AppleTheme::colors);
+    writeRules(out, InlineStyles::rules);
+};
+
+constexpr auto emitMinifiedTheme = [](CssWriter& out) {
+    CssMinifier minifier(out);
+    writeMinifiedRules(minifier, DesignSystem::globalStyles);
+    writeMinifiedRules(minifier, DesignSystem::componentStyles);
+    writeMinifiedRules(minifier, DesignSystem::layoutStyles);
+    writeMinifiedRules(minifier, DesignSystem::responsiveStyles);
+    writeMinifiedRules(minifier, AppleTheme::typography);
+    writeMinifiedRules(minifier, AppleTheme::colors);
+    writeMinifiedRules(minifier, InlineStyles::rules);
+};
+
+constexpr auto themeCss = materialize<measure(emitTheme)>(emitTheme);
+constexpr auto minifiedThemeCss = materialize<measure(emitMinifiedTheme)>(emitMinifiedTheme);
+constexpr auto themeHash = hexDigest(minifiedThemeCss.view());
+
+constexpr auto emitThemeUrl = [](CssWriter& out) {
+    out.append("/assets/theme-");
+    out.append(themeHash.view());
+    out.append(".css");
+};
+
+constexpr auto themeUrl = materialize<measure(emitThemeUrl)>(emitThemeUrl);
+
+} // namespace
+
+std::string_view ThemeStyleSheet::css() {
+    return themeCss.view();
+}
+
+std::string_view ThemeStyleSheet::minifiedCss() {
+    return minifiedThemeCss.view();
+}
+
+std::string_view ThemeStyleSheet::hash() {
+    return themeHash.view();
+}
+
+std::string_view ThemeStyleSheet::url() {
+    return themeUrl.view();
+}
+
+} // namespace Styles
+} // namespace CSPNet
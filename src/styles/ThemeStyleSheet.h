@@ -0,0 +1,20 @@
+#pragma once
+#include <string_view>
+
+namespace CSPNet {
+namespace Styles {
+
+// The complete design system. Its text, minified form and content hash
+// are produced at compile time from the DesignSystem and AppleTheme
+// rule tables; every session links to the same content-hashed URL,
+// which matches the name the asset pipeline gives "/theme.css".
+class ThemeStyleSheet {
+public:
+    static std::string_view css();
+    static std::string_view minifiedCss();
+    static std::string_view hash();
+    static std::string_view url();
+};
+
+} // namespace Styles
+} // namespace CSPNet
@@ -0,0 +1,307 @@
+#pragma once
+#if !defined(__cpp_impl_coroutine)
+#error "Tasks/Async.h needs C++20 coroutines; configure with -DCSP_NET_CXX20=ON"
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "../logging/Logger.h"
+#include "SessionTasks.h"
+
+// Controller actions as coroutines on a session's SessionTasks:
+//
+//     Tasks::Action HomeController::getStarted() {
+//         auto features = co_await Tasks::callback<Api::ApiResponse>(tasks_, [](auto resolve) {
+//             Api::ApiClient::get("/api/features", std::move(resolve));
+//         });
+//         auto count = co_await Tasks::offload(tasks_, [&features]() { return parse(features); });
+//         view->setCount(count);
+//     }
+//
+// The action runs with the session locked up to its first co_await. Every
+// co_await on offload() or callback() then gives the lock back and resumes
+// as a new posted event of the same session, so code between waits may
+// touch widgets and no wait holds the lock.
+//
+// When the session ends during a wait, the co_await throws Cancelled and
+// the frame unwinds wherever its wait is given up: in ~Application (which
+// cancels the tasks first, while controllers and widgets still exist) for
+// queued work, or on the pool or I/O thread whose result arrives after the
+// session is gone. Only destructors of the frame's locals run then, so
+// locals must not own widgets or other session state.
+
+namespace CSPNet {
+namespace Tasks {
+
+// Thrown out of a co_await whose session ended before it could resume. Let
+// it propagate; Action ends quietly on it.
+struct Cancelled : std::exception {
+    const char* what() const noexcept override { return "session ended"; }
+};
+
+template <typename T = void>
+class Async;
+
+namespace detail {
+
+struct PromiseBase {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr error;
+    
+    // Lazy: starts when awaited, and resumes its awaiter when done
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> done) noexcept {
+            auto next = done.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+    };
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+};
+
+template <typename T>
+struct Promise : PromiseBase {
+    std::optional<T> value;
+    
+    Async<T> get_return_object();
+    template <typename U>
+    void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+    
+    T take() {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return std::move(*value);
+    }
+};
+
+template <>
+struct Promise<void> : PromiseBase {
+    Async<void> get_return_object();
+    void return_void() {}
+    
+    void take() {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+// Result of a wait, filled in off the session and read after resuming on it
+template <typename T>
+struct Outcome {
+    std::optional<T> value;
+    std::exception_ptr error;
+    bool cancelled = false;
+    
+    template <typename Work>
+    void capture(Work& work) {
+        try {
+            value.emplace(work());
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    
+    T take() {
+        if (cancelled) {
+            throw Cancelled();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return std::move(*value);
+    }
+};
+
+template <>
+struct Outcome<void> {
+    std::exception_ptr error;
+    bool cancelled = false;
+    
+    template <typename Work>
+    void capture(Work& work) {
+        try {
+            work();
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    
+    void take() {
+        if (cancelled) {
+            throw Cancelled();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+// Shared by everything that may resume a waiting coroutine. Whoever calls
+// it resumes normally; if every copy is dropped first (the session ended,
+// queued work was cancelled), the last one resumes with Cancelled so the
+// coroutine frame unwinds instead of leaking, on the dropping thread.
+class Resumption {
+public:
+    Resumption(std::coroutine_handle<> handle, bool& cancelled) : handle_(handle), cancelled_(cancelled) {}
+    ~Resumption() {
+        if (!resumed_) {
+            cancelled_ = true;
+            handle_.resume();
+        }
+    }
+    
+    Resumption(const Resumption&) = delete;
+    Resumption& operator=(const Resumption&) = delete;
+    
+    void operator()() {
+        resumed_ = true;
+        handle_.resume();
+    }
+    
+private:
+    std::coroutine_handle<> handle_;
+    bool& cancelled_;
+    bool resumed_ = false;
+};
+
+} // namespace detail
+
+// Awaitable coroutine result. Starts when awaited and resumes the awaiting
+// coroutine on whichever thread it finishes; on a session that is the
+// session's own event, because every wait below resumes there.
+template <typename T>
+class [[nodiscard]] Async {
+public:
+    using promise_type = detail::Promise<T>;
+    
+    explicit Async(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+    Async(Async&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Async& operator=(Async&&) = delete;
+    ~Async() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+    
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+    T await_resume() { return handle_.promise().take(); }
+    
+private:
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Async<T> Promise<T>::get_return_object() {
+    return Async<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Async<void> Promise<void>::get_return_object() {
+    return Async<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+} // namespace detail
+
+// Fire-and-forget coroutine for event handlers: starts immediately, frees
+// itself when done. Failures are logged; Cancelled is not a failure.
+class Action {
+public:
+    struct promise_type {
+        Action get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        
+        void unhandled_exception() noexcept {
+            try {
+                throw;
+            } catch (const Cancelled&) {
+            } catch (const std::exception& e) {
+                CSP_LOG_WARN("Tasks: action failed: {}", e.what());
+            } catch (...) {
+                CSP_LOG_WARN("Tasks: action failed with an unknown exception");
+            }
+        }
+    };
+};
+
+// co_await offload(tasks, work): work() runs on the pool, in the session's
+// task order, and the coroutine resumes on the session with its result.
+// Exceptions from work() are rethrown at the co_await.
+template <typename Work>
+auto offload(SessionTasks& tasks, Work work) {
+    using Result = std::invoke_result_t<Work&>;
+    
+    struct Awaiter {
+        SessionTasks& tasks;
+        Work work;
+        detail::Outcome<Result> outcome;
+        
+        bool await_ready() const noexcept { return false; }
+        
+        // Nothing may touch the awaiter once run() returns: the coroutine
+        // can already have resumed and finished by then
+        void await_suspend(std::coroutine_handle<> waiting) {
+            auto resume = std::make_shared<detail::Resumption>(waiting, outcome.cancelled);
+            tasks.run(
+                [this, resume]() { outcome.capture(work); },
+                [resume]() { (*resume)(); });
+        }
+        
+        Result await_resume() { return outcome.take(); }
+    };
+    return Awaiter{ tasks, std::move(work), {} };
+}
+
+// co_await callback<T>(tasks, start): start(resolve) begins an asynchronous
+// operation, such as a Drogon HTTP request, that calls resolve(T) once on
+// any thread. The coroutine resumes on the session with that value. No
+// pool thread waits for the operation.
+template <typename T, typename Start>
+auto callback(SessionTasks& tasks, Start start) {
+    struct Awaiter {
+        SessionTasks& tasks;
+        Start start;
+        detail::Outcome<T> outcome;
+        
+        bool await_ready() const noexcept { return false; }
+        
+        // resolve may run after the session, and its SessionTasks, are gone;
+        // it holds the frame (through resume) and the strand, never tasks
+        void await_suspend(std::coroutine_handle<> waiting) {
+            auto resume = std::make_shared<detail::Resumption>(waiting, outcome.cancelled);
+            std::function<void(T)> resolve = [this, resume, post = tasks.poster()](T result) {
+                outcome.value.emplace(std::move(result));
+                post([resume]() { (*resume)(); });
+            };
+            // Off the frame first: resolve may end the coroutine before
+            // start returns
+            auto begin = std::move(start);
+            begin(std::move(resolve));
+        }
+        
+        T await_resume() { return outcome.take(); }
+    };
+    return Awaiter{ tasks, std::move(start), {} };
+}
+
+} // namespace Tasks
+} // namespace CSPNet
@@ -0,0 +1,111 @@
+#include "SessionTasks.h"
+#include <Wt/WApplication.h>
+#include <Wt/WServer.h>
+#include "../logging/Logger.h"
+#include "TaskExecutor.h"
+
+namespace CSPNet {
+namespace Tasks {
+
+SessionTasks::SessionTasks(std::string sessionId) : strand_(std::make_shared<Strand>()) {
+    strand_->sessionId = std::move(sessionId);
+    strand_->server = Wt::WServer::instance();
+}
+
+SessionTasks::~SessionTasks() {
+    cancel();
+}
+
+void SessionTasks::cancel() {
+    strand_->cancelled.store(true, std::memory_order_release);
+    
+    // Dropped tasks are destroyed outside the lock: what they capture may
+    // react by submitting more
+    std::deque<std::function<void()>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(strand_->mutex);
+        dropped.swap(strand_->queue);
+    }
+}
+
+bool SessionTasks::cancelled() const {
+    return strand_->cancelled.load(std::memory_order_acquire);
+}
+
+void SessionTasks::enqueue(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(strand_->mutex);
+        if (strand_->cancelled.load(std::memory_order_relaxed)) {
+            return;
+        }
+        strand_->queue.push_back(std::move(task));
+        if (strand_->scheduled) {
+            return;
+        }
+        strand_->scheduled = true;
+    }
+    schedule(strand_);
+}
+
+void SessionTasks::schedule(const std::shared_ptr<Strand>& strand) {
+    TaskExecutor::submit([strand]() { drainOne(strand); });
+}
+
+// One task per pool slot, so a busy session cannot hold a worker; the
+// strand is rescheduled behind other sessions' work while it has more
+void SessionTasks::drainOne(const std::shared_ptr<Strand>& strand) {
+    std::function<void()> task;
+    {
+        std::lock_guard<std::mutex> lock(strand->mutex);
+        if (strand->queue.empty() || strand->cancelled.load(std::memory_order_relaxed)) {
+            strand->scheduled = false;
+            return;
+        }
+        task = std::move(strand->queue.front());
+        strand->queue.pop_front();
+    }
+    
+    try {
+        task();
+    } catch (const std::exception& e) {
+        CSP_LOG_WARN("Tasks: work for session {} failed: {}", strand->sessionId, e.what());
+    } catch (...) {
+        // Anything escaping here would leave the strand scheduled forever
+        CSP_LOG_WARN("Tasks: work for session {} failed with a non-standard exception", strand->sessionId);
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(strand->mutex);
+        if (strand->queue.empty() || strand->cancelled.load(std::memory_order_relaxed)) {
+            strand->scheduled = false;
+            return;
+        }
+    }
+    schedule(strand);
+}
+
+void SessionTasks::deliver(const std::shared_ptr<Strand>& strand, std::function<void()> completion) {
+    if (strand->cancelled.load(std::memory_order_acquire)) {
+        return;
+    }
+    if (!strand->server) {
+        // No server to post through, e.g. under Wt::Test
+        CSP_LOG_DEBUG("Tasks: no server, completion for session {} dropped", strand->sessionId);
+        return;
+    }
+    
+    // Posted completions run in order, with the session locked; a session
+    // that has ended in the meantime never sees them. What they change is
+    // pushed if the session has updates enabled.
+    strand->server->post(strand->sessionId, [strand, completion = std::move(completion)]() {
+        if (!strand->cancelled.load(std::memory_order_acquire)) {
+            completion();
+            if (auto app = Wt::WApplication::instance()) {
+                app->triggerUpdate();
+            }
+        }
+    });
+}
+
+} // namespace Tasks
+} // namespace CSPNet
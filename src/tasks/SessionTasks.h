@@ -0,0 +1,108 @@
+#pragma once
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Wt {
+class WServer;
+}
+
+namespace CSPNet {
+namespace Tasks {
+
+// Runs one session's controller work on the TaskExecutor and hands the
+// results back to the session. Work submitted through the same
+// SessionTasks runs one task at a time, in submission order, and its
+// completions reach the session in that order through WServer::post, with
+// the session locked as for any other event.
+//
+// Work runs on a pool thread and must not touch widgets; the completion
+// runs on the session and may. Once the session ends (the SessionTasks is
+// destroyed or cancelled), queued work is dropped and completions that
+// have not run yet are discarded.
+class SessionTasks {
+public:
+    explicit SessionTasks(std::string sessionId);
+    ~SessionTasks();
+    
+    SessionTasks(const SessionTasks&) = delete;
+    SessionTasks& operator=(const SessionTasks&) = delete;
+    
+    // work() runs on the pool; done(result), or done() for void work, runs
+    // on the session. Both must be copyable.
+    template <typename Work, typename Done>
+    void run(Work work, Done done) {
+        enqueue([strand = strand_, work = std::move(work), done = std::move(done)]() mutable {
+            if constexpr (std::is_void_v<std::invoke_result_t<Work&>>) {
+                work();
+                deliver(strand, std::move(done));
+            } else {
+                deliver(strand, [done = std::move(done), result = work()]() mutable {
+                    done(std::move(result));
+                });
+            }
+        });
+    }
+    
+    // Work that reports nothing back
+    template <typename Work>
+    void run(Work work) {
+        enqueue(std::move(work));
+    }
+    
+    // Runs completion on the session from any thread, without a pool slot;
+    // for callbacks of asynchronous I/O. Dropped once the session ends.
+    void post(std::function<void()> completion) {
+        deliver(strand_, std::move(completion));
+    }
+    
+    // post() as a copyable handle for callbacks that may outlive this
+    // SessionTasks; posting through it after the session ended does nothing
+    class Poster;
+    Poster poster() const;
+    
+    void cancel();
+    bool cancelled() const;
+    
+private:
+    struct Strand {
+        std::mutex mutex;
+        std::deque<std::function<void()>> queue;
+        bool scheduled = false;
+        std::atomic<bool> cancelled{false};
+        std::string sessionId;
+        Wt::WServer* server = nullptr;
+    };
+    
+    void enqueue(std::function<void()> task);
+    static void schedule(const std::shared_ptr<Strand>& strand);
+    static void drainOne(const std::shared_ptr<Strand>& strand);
+    static void deliver(const std::shared_ptr<Strand>& strand, std::function<void()> completion);
+    
+    std::shared_ptr<Strand> strand_;
+};
+
+class SessionTasks::Poster {
+public:
+    void operator()(std::function<void()> completion) const {
+        SessionTasks::deliver(strand_, std::move(completion));
+    }
+    
+private:
+    friend class SessionTasks;
+    explicit Poster(std::shared_ptr<Strand> strand) : strand_(std::move(strand)) {}
+    
+    std::shared_ptr<Strand> strand_;
+};
+
+inline SessionTasks::Poster SessionTasks::poster() const {
+    return Poster(strand_);
+}
+
+} // namespace Tasks
+} // namespace CSPNet
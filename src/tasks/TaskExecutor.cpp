@@ -0,0 +1,211 @@
+#include "TaskExecutor.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../logging/Logger.h"
+
+namespace CSPNet {
+namespace Tasks {
+
+namespace {
+
+struct Worker {
+    std::mutex mutex;
+    std::deque<TaskExecutor::Task> tasks;
+};
+
+struct Pool {
+    std::mutex lifecycle;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::atomic<bool> running{false};
+    
+    // Sleeping workers wait here until pending is non-zero
+    std::mutex sleep;
+    std::condition_variable wake;
+    std::atomic<std::size_t> pending{0};
+    std::atomic<std::size_t> next{0};
+    
+    std::atomic<std::uint64_t> executed{0};
+    std::atomic<std::uint64_t> stolen{0};
+    std::atomic<std::uint64_t> failed{0};
+    std::atomic<std::uint64_t> dropped{0};
+};
+
+Pool& pool() {
+    static Pool instance;
+    return instance;
+}
+
+// Index of the worker running on this thread, -1 elsewhere
+thread_local int currentWorker = -1;
+
+bool popOwn(Pool& p, int index, TaskExecutor::Task& task) {
+    auto& worker = *p.workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) {
+        return false;
+    }
+    task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    return true;
+}
+
+bool steal(Pool& p, int index, TaskExecutor::Task& task) {
+    const auto count = p.workers.size();
+    for (std::size_t offset = 1; offset < count; ++offset) {
+        auto& victim = *p.workers[(index + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            p.stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void execute(Pool& p, TaskExecutor::Task& task) {
+    try {
+        task();
+        p.executed.fetch_add(1, std::memory_order_relaxed);
+    } catch (const std::exception& e) {
+        p.failed.fetch_add(1, std::memory_order_relaxed);
+        CSP_LOG_WARN("Tasks: task failed: {}", e.what());
+    } catch (...) {
+        p.failed.fetch_add(1, std::memory_order_relaxed);
+        CSP_LOG_WARN("Tasks: task failed with an unknown exception");
+    }
+}
+
+void workerLoop(int index) {
+    auto& p = pool();
+    currentWorker = index;
+    
+    while (p.running.load(std::memory_order_acquire)) {
+        TaskExecutor::Task task;
+        if (popOwn(p, index, task) || steal(p, index, task)) {
+            p.pending.fetch_sub(1, std::memory_order_relaxed);
+            execute(p, task);
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(p.sleep);
+        p.wake.wait(lock, [&p]() {
+            return p.pending.load(std::memory_order_relaxed) > 0 || !p.running.load(std::memory_order_relaxed);
+        });
+    }
+    currentWorker = -1;
+}
+
+} // namespace
+
+void TaskExecutor::start(std::size_t threads) {
+    auto& p = pool();
+    std::lock_guard<std::mutex> lock(p.lifecycle);
+    if (p.running.load()) {
+        return;
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    
+    p.workers.clear();
+    for (std::size_t i = 0; i < threads; ++i) {
+        p.workers.push_back(std::make_unique<Worker>());
+    }
+    p.running.store(true, std::memory_order_release);
+    for (std::size_t i = 0; i < threads; ++i) {
+        p.threads.emplace_back(workerLoop, static_cast<int>(i));
+    }
+    CSP_LOG_INFO("Tasks: executor started with {} threads", threads);
+}
+
+void TaskExecutor::stop() {
+    auto& p = pool();
+    std::lock_guard<std::mutex> lock(p.lifecycle);
+    if (!p.running.load()) {
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> sleepLock(p.sleep);
+        p.running.store(false, std::memory_order_release);
+    }
+    p.wake.notify_all();
+    for (auto& thread : p.threads) {
+        thread.join();
+    }
+    p.threads.clear();
+    
+    std::size_t dropped = 0;
+    for (auto& worker : p.workers) {
+        dropped += worker->tasks.size();
+        worker->tasks.clear();
+    }
+    p.pending.store(0);
+    p.dropped.fetch_add(dropped, std::memory_order_relaxed);
+    if (dropped > 0) {
+        CSP_LOG_INFO("Tasks: executor stopped, {} queued tasks dropped", dropped);
+    }
+}
+
+bool TaskExecutor::running() {
+    return pool().running.load(std::memory_order_acquire);
+}
+
+std::size_t TaskExecutor::threads() {
+    auto& p = pool();
+    std::lock_guard<std::mutex> lock(p.lifecycle);
+    return p.threads.size();
+}
+
+void TaskExecutor::submit(Task task) {
+    auto& p = pool();
+    if (!p.running.load(std::memory_order_acquire)) {
+        execute(p, task);
+        return;
+    }
+    
+    // Workers keep what they spawn, others are spread round robin
+    const auto index = currentWorker >= 0
+        ? static_cast<std::size_t>(currentWorker)
+        : p.next.fetch_add(1, std::memory_order_relaxed) % p.workers.size();
+    p.pending.fetch_add(1, std::memory_order_relaxed);
+    {
+        auto& worker = *p.workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    
+    // Taking the lock orders this against a worker about to sleep
+    { std::lock_guard<std::mutex> lock(p.sleep); }
+    p.wake.notify_one();
+}
+
+std::string TaskExecutor::renderPrometheus() {
+    auto& p = pool();
+    std::string out;
+    out += "# HELP csp_net_tasks_total Controller tasks by outcome.\n"
+           "# TYPE csp_net_tasks_total counter\n"
+           "csp_net_tasks_total{outcome=\"executed\"} " + std::to_string(p.executed.load()) + "\n"
+           "csp_net_tasks_total{outcome=\"failed\"} " + std::to_string(p.failed.load()) + "\n"
+           "csp_net_tasks_total{outcome=\"dropped\"} " + std::to_string(p.dropped.load()) + "\n"
+           "# HELP csp_net_tasks_stolen_total Tasks taken from another worker's queue.\n"
+           "# TYPE csp_net_tasks_stolen_total counter\n"
+           "csp_net_tasks_stolen_total " + std::to_string(p.stolen.load()) + "\n"
+           "# HELP csp_net_tasks_queued Tasks waiting for a worker.\n"
+           "# TYPE csp_net_tasks_queued gauge\n"
+           "csp_net_tasks_queued " + std::to_string(p.pending.load()) + "\n";
+    return out;
+}
+
+} // namespace Tasks
+} // namespace CSPNet
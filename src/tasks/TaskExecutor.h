@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace CSPNet {
+namespace Tasks {
+
+// Process-wide pool for work that should not run on a Wt event thread.
+// Every worker owns a deque: it takes its own newest task first and, when
+// idle, steals the oldest task of another worker. Tasks submitted from
+// outside the pool are spread over the workers round robin.
+class TaskExecutor {
+public:
+    using Task = std::function<void()>;
+    
+    // 0 threads = one per hardware thread
+    static void start(std::size_t threads = 0);
+    
+    // Drops queued tasks and joins the workers once their current task ends
+    static void stop();
+    
+    static bool running();
+    static std::size_t threads();
+    
+    // Before start() and after stop(), runs the task on the calling thread
+    static void submit(Task task);
+    
+    // Counters in Prometheus text format
+    static std::string renderPrometheus();
+};
+
+} // namespace Tasks
+} // namespace CSPNet
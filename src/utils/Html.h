@@ -0,0 +1,23 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace CSPNet {
+namespace Utils {
+
+// Appends text with the characters that are special in HTML escaped
+inline void appendHtmlEscaped(std::string& out, std::string_view text) {
+    for (char c : text) {
+        switch (c) {
+            case '&':  out += "&amp;"; break;
+            case '<':  out += "&lt;"; break;
+            case '>':  out += "&gt;"; break;
+            case '"':  out += "&quot;"; break;
+            case '\'': out += "&#39;"; break;
+            default:   out += c;
+        }
+    }
+}
+
+} // namespace Utils
+} // namespace CSPNet
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdlib>
+#include <string>
+
+namespace CSPNet {
+namespace Utils {
+
+// True when an Accept-Encoding header allows gzip with a q-value above 0
+inline bool acceptsGzip(const std::string& acceptEncoding) {
+    auto pos = acceptEncoding.find("gzip");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    auto end = acceptEncoding.find(',', pos);
+    auto params = acceptEncoding.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+    auto q = params.find("q=");
+    return q == std::string::npos || std::strtod(params.c_str() + q + 2, nullptr) > 0.0;
+}
+
+// Weak comparison of an If-None-Match header against an ETag
+inline bool etagMatches(const std::string& ifNoneMatch, const std::string& etag) {
+    if (ifNoneMatch.empty()) {
+        return false;
+    }
+    
+    std::size_t start = 0;
+    while (start < ifNoneMatch.size()) {
+        auto end = ifNoneMatch.find(',', start);
+        if (end == std::string::npos) {
+            end = ifNoneMatch.size();
+        }
+        
+        auto candidate = ifNoneMatch.substr(start, end - start);
+        auto first = candidate.find_first_not_of(" \t");
+        auto last = candidate.find_last_not_of(" \t");
+        if (first != std::string::npos) {
+            candidate = candidate.substr(first, last - first + 1);
+            if (candidate.compare(0, 2, "W/") == 0) {
+                candidate = candidate.substr(2);
+            }
+            if (candidate == "*" || candidate == etag) {
+                return true;
+            }
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+} // namespace Utils
+} // namespace CSPNet
@@ -1,6 +1,6 @@
 #include "CreditCard.h"
-#include <Wt/WVBoxLayout.h>
 #include <Wt/WText.h>
+#include "../../memory/AllocationTracker.h"
 
 namespace CSPNet {
 namespace Views {
@@ -11,19 +11,27 @@ CreditCard::CreditCard(const Models::CreditModel& credit) : credit_(credit) {
 }
 
 void CreditCard::setupCard() {
+    CSP_COMPONENT_ALLOCATIONS("credit_card");
     setStyleClass("credit-card");
     createCardStructure();
 }
 
 void CreditCard::createCardStructure() {
-    auto layout = setLayout(std::make_unique<Wt::WVBoxLayout>());
-    layout->setContentsMargins(0, 0, 0, 0);
+    nameText_ = addWidget(std::make_unique<Wt::WText>(credit_.name));
+    nameText_->setStyleClass("credit-name");
     
-    auto nameWidget = layout->addWidget(std::make_unique<Wt::WText>(credit_.name));
-    nameWidget->setStyleClass("credit-name");
-    
-    auto roleWidget = layout->addWidget(std::make_unique<Wt::WText>(credit_.role));
-    roleWidget->setStyleClass("credit-role");
+    roleText_ = addWidget(std::make_unique<Wt::WText>(credit_.role));
+    roleText_->setStyleClass("credit-role");
+}
+
+void CreditCard::setCredit(const Models::CreditModel& credit) {
+    // An unchanged card sends nothing to the browser
+    if (credit == credit_) {
+        return;
+    }
+    credit_ = credit;
+    nameText_->setText(credit_.name);
+    roleText_->setText(credit_.role);
 }
 
 } // namespace Components
@@ -1,5 +1,6 @@
 #pragma once
 #include <Wt/WContainerWidget.h>
+#include <Wt/WText.h>
 #include <string>
 #include "../../models/FeatureModel.h"
 
@@ -14,8 +15,14 @@ public:
     void setupCard();
     void setupContent();
     
+    // Rebinds the card to another credit so it can be recycled
+    void setCredit(const Models::CreditModel& credit);
+    const Models::CreditModel& credit() const { return credit_; }
+    
 private:
     Models::CreditModel credit_;
+    Wt::WText* nameText_ = nullptr;
+    Wt::WText* roleText_ = nullptr;
     
     void createCardStructure();
     void addHoverEffects();
@@ -1,6 +1,6 @@
 #include "FeatureCard.h"
-#include <Wt/WVBoxLayout.h>
 #include <Wt/WText.h>
+#include "../../memory/AllocationTracker.h"
 
 namespace CSPNet {
 namespace Views {
@@ -11,18 +11,16 @@ FeatureCard::FeatureCard(const Models::FeatureModel& feature) : feature_(feature
 }
 
 void FeatureCard::setupCard() {
+    CSP_COMPONENT_ALLOCATIONS("feature_card");
     setStyleClass("feature-card");
     createCardStructure();
 }
 
 void FeatureCard::createCardStructure() {
-    auto layout = setLayout(std::make_unique<Wt::WVBoxLayout>());
-    layout->setContentsMargins(0, 0, 0, 0);
-    
-    auto titleWidget = layout->addWidget(std::make_unique<Wt::WText>(feature_.title));
+    auto titleWidget = addWidget(std::make_unique<Wt::WText>(feature_.title));
     titleWidget->setStyleClass("feature-title");
     
-    auto descWidget = layout->addWidget(std::make_unique<Wt::WText>(feature_.description));
+    auto descWidget = addWidget(std::make_unique<Wt::WText>(feature_.description));
     descWidget->setStyleClass("feature-desc");
 }
 
@@ -1,80 +1,70 @@
 #include "Navigation.h"
-#include <Wt/WVBoxLayout.h>
-#include <Wt/WHBoxLayout.h>
-#include <Wt/WText.h>
+#include "../../memory/AllocationTracker.h"
 
 namespace CSPNet {
 namespace Views {
 namespace Components {
 
-Navigation::Navigation(std::function<void(const std::string&)> onNavigate)
-    : onNavigate_(onNavigate), activePage_("home"), homeNavItem_(nullptr), creditsNavItem_(nullptr) {
+NavigationMenu::NavigationMenu(std::vector<NavigationItem> items) : items_(std::move(items)) {
+    std::string xhtml = "<div class=\"nav-container\"><span class=\"nav-logo\">CSP-NET</span><div class=\"nav-menu\">";
+    for (std::size_t i = 0; i < items_.size(); ++i) {
+        index_.emplace(items_[i].page, static_cast<int>(i));
+        xhtml += "${" + itemName(items_[i].page) + "}";
+    }
+    xhtml += "</div></div>";
+    skeleton_ = std::make_shared<const PageTemplate>(xhtml, nullptr);
+}
+
+int NavigationMenu::indexOf(const std::string& page) const {
+    auto it = index_.find(page);
+    return it == index_.end() ? -1 : it->second;
+}
+
+Navigation::Navigation(std::shared_ptr<const NavigationMenu> menu, std::function<void(const std::string&)> onNavigate)
+    : SharedTemplate(menu->skeleton()), menu_(std::move(menu)), onNavigate_(std::move(onNavigate)), activeItem_(-1) {
     setupNavigation();
 }
 
 void Navigation::setupNavigation() {
+    CSP_COMPONENT_ALLOCATIONS("navigation");
     setStyleClass("nav-bar");
     createNavigationStructure();
 }
 
 void Navigation::createNavigationStructure() {
-    auto navContainer = addWidget(std::make_unique<Wt::WContainerWidget>());
-    navContainer->setStyleClass("nav-container");
-    
-    auto navLayout = navContainer->setLayout(std::make_unique<Wt::WHBoxLayout>());
-    navLayout->setContentsMargins(0, 0, 0, 0);
-    
-    // Logo
-    auto logo = navLayout->addWidget(std::make_unique<Wt::WText>("CSP-NET"));
-    logo->setStyleClass("nav-logo");
-    
-    navLayout->addStretch(1);
-    
-    // Navigation menu
-    auto navMenu = navLayout->addWidget(std::make_unique<Wt::WContainerWidget>());
-    navMenu->setStyleClass("nav-menu");
-    
-    auto menuLayout = navMenu->setLayout(std::make_unique<Wt::WHBoxLayout>());
-    menuLayout->setContentsMargins(0, 0, 0, 0);
-    
-    // Home link
-    homeNavItem_ = menuLayout->addWidget(std::make_unique<Wt::WText>("Home"));
-    homeNavItem_->setStyleClass("nav-item active");
-    homeNavItem_->clicked().connect([=]() {
-        onNavigate_("home");
-    });
-    
-    // Credits link
-    creditsNavItem_ = menuLayout->addWidget(std::make_unique<Wt::WText>("Credits"));
-    creditsNavItem_->setStyleClass("nav-item");
-    creditsNavItem_->clicked().connect([=]() {
-        onNavigate_("credits");
-    });
+    // Logo and menu markup come from the shared skeleton; only the items,
+    // which carry the click handlers and the highlight, are widgets
+    const auto& items = menu_->items();
+    items_.reserve(items.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        const auto name = NavigationMenu::itemName(items[i].page);
+        auto item = bindWidget(name, std::make_unique<Wt::WText>(items[i].label));
+        item->setStyleClass("nav-item");
+        item->setObjectName(name);
+        item->clicked().connect([this, i]() {
+            onNavigate_(menu_->items()[i].path);
+        });
+        items_.push_back(item);
+    }
 }
 
 void Navigation::setActivePage(const std::string& page) {
-    activePage_ = page;
-    updateNavigationStyles();
+    setActiveItem(menu_->indexOf(page));
 }
 
-void Navigation::updateNavigationStyles() {
-    if (homeNavItem_) {
-        if (activePage_ == "home") {
-            homeNavItem_->setStyleClass("nav-item active");
-        } else {
-            homeNavItem_->setStyleClass("nav-item");
-        }
+void Navigation::setActiveItem(int index) {
+    if (index == activeItem_) {
+        return;
+    }
+    if (activeItem_ >= 0) {
+        items_[activeItem_]->removeStyleClass("active");
     }
-    
-    if (creditsNavItem_) {
-        if (activePage_ == "credits") {
-            creditsNavItem_->setStyleClass("nav-item active");
-        } else {
-            creditsNavItem_->setStyleClass("nav-item");
-        }
+    if (index >= 0) {
+        items_[index]->addStyleClass("active");
     }
+    activeItem_ = index;
 }
 
 } // namespace Components
 } // namespace Views
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
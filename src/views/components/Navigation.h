@@ -1,34 +1,62 @@
 #pragma once
-#include <Wt/WContainerWidget.h>
 #include <Wt/WText.h>
 #include <functional>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
+#include "SharedTemplate.h"
 
 namespace CSPNet {
 namespace Views {
 namespace Components {
 
-class Navigation : public Wt::WContainerWidget {
+struct NavigationItem {
+    std::string page;   // name passed to Navigation::setActivePage
+    std::string label;
+    std::string path;   // internal path the item navigates to
+};
+
+// The pages linked from the navigation bar, built once per process. Holds
+// the bar's markup, shared by every session, and an index by page name.
+class NavigationMenu {
+public:
+    explicit NavigationMenu(std::vector<NavigationItem> items);
+    
+    const std::vector<NavigationItem>& items() const { return items_; }
+    // Position of a page in the menu, -1 if it has no item
+    int indexOf(const std::string& page) const;
+    
+    const std::shared_ptr<const PageTemplate>& skeleton() const { return skeleton_; }
+    
+    // Object name of a page's item, rendered as data-object-name
+    static std::string itemName(const std::string& page) { return "nav-" + page; }
+    
+private:
+    std::vector<NavigationItem> items_;
+    std::unordered_map<std::string, int> index_;
+    std::shared_ptr<const PageTemplate> skeleton_;
+};
+
+class Navigation : public SharedTemplate {
 public:
-    Navigation(std::function<void(const std::string&)> onNavigate);
+    // onNavigate receives the internal path of the clicked item
+    Navigation(std::shared_ptr<const NavigationMenu> menu, std::function<void(const std::string&)> onNavigate);
     
+    // Moves the highlight; only the old and the new item change
     void setActivePage(const std::string& page);
+    void setActiveItem(int index);
     void setupNavigation();
     
 private:
+    std::shared_ptr<const NavigationMenu> menu_;
     std::function<void(const std::string&)> onNavigate_;
-    std::string activePage_;
-    Wt::WText* homeNavItem_;
-    Wt::WText* creditsNavItem_;
+    std::vector<Wt::WText*> items_;
+    int activeItem_;
     
     void createNavigationStructure();
-    void addNavigationItem(Wt::WContainerWidget* menu, 
-                          const std::string& text, 
-                          const std::string& page, 
-                          bool active = false);
-    void updateNavigationStyles();
 };
 
 } // namespace Components
 } // namespace Views
-} // namespace CSPNet
\ No newline at end of file
+} // namespace CSPNet
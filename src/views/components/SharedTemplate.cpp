@@ -0,0 +1,103 @@
+#include "SharedTemplate.h"
+#include <atomic>
+#include "../../logging/Logger.h"
+#include "../../utils/Html.h"
+
+namespace CSPNet {
+namespace Views {
+namespace Components {
+
+PageTemplate::PageTemplate(std::string_view xhtml, std::shared_ptr<const Models::ContentSnapshot> content)
+    : content_(std::move(content)) {
+    std::string literal;
+    std::size_t pos = 0;
+    while (pos < xhtml.size()) {
+        const auto dollar = xhtml.find('$', pos);
+        if (dollar == std::string_view::npos || dollar + 1 == xhtml.size()) {
+            literal.append(xhtml.substr(pos));
+            break;
+        }
+        literal.append(xhtml.substr(pos, dollar - pos));
+        
+        if (xhtml[dollar + 1] == '$') {
+            literal += '$';
+            pos = dollar + 2;
+            continue;
+        }
+        
+        const auto close = xhtml[dollar + 1] == '{' ? xhtml.find('}', dollar) : std::string_view::npos;
+        if (close == std::string_view::npos) {
+            literal += '$';
+            pos = dollar + 1;
+            continue;
+        }
+        
+        if (!literal.empty()) {
+            segments_.push_back({ std::move(literal), false });
+            literal.clear();
+        }
+        std::string name(xhtml.substr(dollar + 2, close - dollar - 2));
+        bindings_.push_back(name);
+        segments_.push_back({ std::move(name), true });
+        pos = close + 1;
+    }
+    if (!literal.empty()) {
+        segments_.push_back({ std::move(literal), false });
+    }
+}
+
+void PageTemplate::appendText(std::string& xhtml, std::string_view text) {
+    std::size_t start = 0;
+    for (auto dollar = text.find('$'); dollar != std::string_view::npos; dollar = text.find('$', start)) {
+        Utils::appendHtmlEscaped(xhtml, text.substr(start, dollar + 1 - start));
+        xhtml += '$';
+        start = dollar + 1;
+    }
+    Utils::appendHtmlEscaped(xhtml, text.substr(start));
+}
+
+std::shared_ptr<const PageTemplate> TemplateCache::get() {
+    auto content = Models::ContentSnapshot::current();
+    auto cached = std::atomic_load(&current_);
+    if (cached && cached->content() == content.get()) {
+        return cached;
+    }
+    
+    // Racing builders render the same snapshot; whichever lands last is kept
+    auto skeleton = std::make_shared<const PageTemplate>(render_(*content), content);
+    CSP_LOG_DEBUG("Templates: parsed skeleton with {} segments, {} bindings",
+                  skeleton->segments().size(), skeleton->bindings().size());
+    std::atomic_store(&current_, skeleton);
+    return skeleton;
+}
+
+SharedTemplate::SharedTemplate(std::shared_ptr<const PageTemplate> skeleton)
+    : skeleton_(std::move(skeleton)) {
+}
+
+void SharedTemplate::setSkeleton(std::shared_ptr<const PageTemplate> skeleton) {
+    if (skeleton == skeleton_) {
+        return;
+    }
+    skeleton_ = std::move(skeleton);
+    
+    // The text itself is never used; setting it marks the template changed
+    setTemplateText(Wt::WString(), Wt::TextFormat::UnsafeXHTML);
+}
+
+bool SharedTemplate::renderTemplateText(std::ostream& result, const Wt::WString&) {
+    // Literal runs are streamed as is; bindings resolve like ${name} would
+    static const std::vector<Wt::WString> noArgs;
+    for (const auto& segment : skeleton_->segments()) {
+        if (segment.binding) {
+            resolveString(segment.text, noArgs, result);
+        } else {
+            result << segment.text;
+        }
+    }
+    return true;
+}
+
+} // namespace Components
+} // namespace Views
+} // namespace CSPNet
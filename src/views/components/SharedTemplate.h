@@ -0,0 +1,76 @@
+#pragma once
+#include <Wt/WTemplate.h>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../../models/ContentSnapshot.h"
+
+namespace CSPNet {
+namespace Views {
+namespace Components {
+
+// XHTML skeleton of a page, split once into literal runs and ${name}
+// bindings. Immutable, so every session renders from the same instance.
+class PageTemplate {
+public:
+    struct Segment {
+        std::string text;   // markup, or the binding name
+        bool binding;
+    };
+    
+    // "$$" stands for a literal '$'
+    PageTemplate(std::string_view xhtml, std::shared_ptr<const Models::ContentSnapshot> content);
+    
+    const std::vector<Segment>& segments() const { return segments_; }
+    const std::vector<std::string>& bindings() const { return bindings_; }
+    
+    // Snapshot the markup was rendered from
+    const Models::ContentSnapshot* content() const { return content_.get(); }
+    
+    // Appends text for a skeleton: HTML-escaped, with '$' doubled
+    static void appendText(std::string& xhtml, std::string_view text);
+    
+private:
+    std::vector<Segment> segments_;
+    std::vector<std::string> bindings_;
+    std::shared_ptr<const Models::ContentSnapshot> content_;
+};
+
+// One skeleton per published content snapshot. The first page built after
+// new content is published renders and parses it; everyone else shares it.
+class TemplateCache {
+public:
+    using Render = std::string (*)(const Models::ContentSnapshot& content);
+    
+    explicit TemplateCache(Render render) : render_(render) {}
+    
+    std::shared_ptr<const PageTemplate> get();
+    
+private:
+    Render render_;
+    std::shared_ptr<const PageTemplate> current_;
+};
+
+// WTemplate that renders a shared PageTemplate instead of its own template
+// text. A session only holds the skeleton pointer and the widgets bound to
+// its ${name} slots.
+class SharedTemplate : public Wt::WTemplate {
+public:
+    explicit SharedTemplate(std::shared_ptr<const PageTemplate> skeleton);
+    
+    const PageTemplate& skeleton() const { return *skeleton_; }
+    
+    // Re-renders from another skeleton; bound widgets stay bound
+    void setSkeleton(std::shared_ptr<const PageTemplate> skeleton);
+    
+    bool renderTemplateText(std::ostream& result, const Wt::WString& templateText) override;
+    
+private:
+    std::shared_ptr<const PageTemplate> skeleton_;
+};
+
+} // namespace Components
+} // namespace Views
+} // namespace CSPNet
@@ -0,0 +1,117 @@
+#include "VirtualCreditsGrid.h"
+#include <algorithm>
+#include <string>
+#include "../../memory/AllocationTracker.h"
+#include "../../models/FeatureModel.h"
+
+namespace CSPNet {
+namespace Views {
+namespace Components {
+
+VirtualCreditsGrid::VirtualCreditsGrid() {
+    setupGrid();
+}
+
+void VirtualCreditsGrid::setupGrid() {
+    CSP_COMPONENT_ALLOCATIONS("credits_grid");
+    setObjectName(widgetName);
+    setStyleClass("credits-viewport");
+    setOverflow(Wt::Overflow::Auto);
+    
+    // The spacer has the height of the full list so the scrollbar is right;
+    // the window holding the cards is moved to the first visible row
+    spacer_ = addWidget(std::make_unique<Wt::WContainerWidget>());
+    spacer_->setStyleClass("credits-spacer");
+    
+    window_ = spacer_->addWidget(std::make_unique<Wt::WContainerWidget>());
+    window_->setStyleClass("credits-window");
+    window_->setPositionScheme(Wt::PositionScheme::Absolute);
+    
+    scrolled().connect([this](const Wt::WScrollEvent& event) {
+        handleScroll(event);
+    });
+    
+    // Until the browser reports its viewport, assume a typical desktop one
+    updateWindow(0, maxColumns * minCardWidth, visibleRows_ * rowHeight);
+    rebind();
+    
+    // Report the real viewport size once rendered
+    doJavaScript(jsRef() + ".dispatchEvent(new Event('scroll'));");
+}
+
+void VirtualCreditsGrid::rebind() {
+    creditCount_ = Models::AppData::creditCount();
+    const auto rows = (creditCount_ + columns_ - 1) / columns_;
+    spacer_->setHeight(Wt::WLength(static_cast<double>(rows * rowHeight)));
+    fillWindow();
+}
+
+void VirtualCreditsGrid::scrollToCredit(std::size_t index) {
+    const auto row = index / static_cast<std::size_t>(columns_);
+    
+    // The resulting scroll event moves the window
+    doJavaScript(jsRef() + ".scrollTop = " + std::to_string(row * rowHeight) + ";");
+}
+
+void VirtualCreditsGrid::handleScroll(const Wt::WScrollEvent& event) {
+    // A hidden grid reports an empty viewport; keep the last window
+    if (event.viewportWidth() <= 0 || event.viewportHeight() <= 0) {
+        return;
+    }
+    
+    const auto columns = columns_;
+    const auto firstRow = firstRow_;
+    const auto visibleRows = visibleRows_;
+    updateWindow(event.scrollY(), event.viewportWidth(), event.viewportHeight());
+    
+    if (columns_ != columns) {
+        rebind();
+    } else if (firstRow_ != firstRow || visibleRows_ != visibleRows) {
+        fillWindow();
+    }
+}
+
+void VirtualCreditsGrid::updateWindow(int scrollTop, int viewportWidth, int viewportHeight) {
+    const auto columns = std::clamp(viewportWidth / minCardWidth, 1, maxColumns);
+    if (columns != columns_) {
+        window_->removeStyleClass("columns-" + std::to_string(columns_));
+        columns_ = columns;
+    }
+    window_->addStyleClass("columns-" + std::to_string(columns_));
+    
+    visibleRows_ = std::clamp((viewportHeight + rowHeight - 1) / rowHeight + 1, 1, maxVisibleRows);
+    const auto topRow = std::max(0, scrollTop / rowHeight - overscanRows);
+    firstRow_ = static_cast<std::size_t>(topRow);
+}
+
+void VirtualCreditsGrid::fillWindow() {
+    resizePool(static_cast<std::size_t>((visibleRows_ + 2 * overscanRows) * columns_));
+    
+    const auto first = firstRow_ * static_cast<std::size_t>(columns_);
+    const auto credits = Models::AppData::getCredits(first, pool_.size());
+    for (std::size_t i = 0; i < pool_.size(); ++i) {
+        if (i < credits.size()) {
+            pool_[i]->setCredit(credits[i]);
+        }
+        pool_[i]->setHidden(i >= credits.size());
+    }
+    
+    window_->setOffsets(Wt::WLength(static_cast<double>(firstRow_ * rowHeight)), Wt::Side::Top);
+}
+
+void VirtualCreditsGrid::resizePool(std::size_t size) {
+    // Cards are only created the first time the window grows and are
+    // recycled from then on
+    while (pool_.size() < size) {
+        auto card = window_->addWidget(std::make_unique<CreditCard>(Models::CreditModel("", "")));
+        pool_.push_back(card);
+    }
+    while (pool_.size() > size) {
+        window_->removeWidget(pool_.back());
+        pool_.pop_back();
+    }
+}
+
+} // namespace Components
+} // namespace Views
+} // namespace CSPNet
@@ -0,0 +1,53 @@
+#pragma once
+#include <Wt/WContainerWidget.h>
+#include <cstddef>
+#include <vector>
+#include "CreditCard.h"
+
+namespace CSPNet {
+namespace Views {
+namespace Components {
+
+// Scrollable credits grid that only materializes the rows in view. A fixed
+// pool of CreditCards is rebound to a new page of credits as the user
+// scrolls, so the widget tree stays the same size however long the list is.
+class VirtualCreditsGrid : public Wt::WContainerWidget {
+public:
+    // Card height plus grid gap; must match .credits-window in the theme
+    static constexpr int rowHeight = 260;
+    static constexpr int minCardWidth = 350;
+    static constexpr int maxColumns = 4;
+    static constexpr int maxVisibleRows = 8;
+    static constexpr int overscanRows = 1;
+    static constexpr const char* widgetName = "credits-grid";
+    
+    VirtualCreditsGrid();
+    
+    void setupGrid();
+    
+    // Re-reads the credit count and rebinds the visible window; not
+    // WWidget::refresh(), which Wt still propagates to the cards
+    void rebind();
+    
+    // Scrolls so the row holding the credit at index is at the top
+    void scrollToCredit(std::size_t index);
+    
+private:
+    void handleScroll(const Wt::WScrollEvent& event);
+    void updateWindow(int scrollTop, int viewportWidth, int viewportHeight);
+    void fillWindow();
+    void resizePool(std::size_t size);
+    
+    Wt::WContainerWidget* spacer_ = nullptr;
+    Wt::WContainerWidget* window_ = nullptr;
+    std::vector<CreditCard*> pool_;
+    
+    std::size_t creditCount_ = 0;
+    std::size_t firstRow_ = 0;
+    int columns_ = 3;
+    int visibleRows_ = 3;
+};
+
+} // namespace Components
+} // namespace Views
+} // namespace CSPNet
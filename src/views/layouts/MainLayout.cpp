@@ -1,11 +1,11 @@
 #include "MainLayout.h"
-#include <Wt/WVBoxLayout.h>
 
 namespace CSPNet {
 namespace Views {
 namespace Layouts {
 
-MainLayout::MainLayout() : navigation_(nullptr), contentStack_(nullptr) {
+MainLayout::MainLayout(std::shared_ptr<const Components::NavigationMenu> menu)
+    : menu_(std::move(menu)), navigation_(nullptr), contentStack_(nullptr) {
     setupLayout();
 }
 
@@ -15,34 +15,20 @@ void MainLayout::setupLayout() {
 }
 
 void MainLayout::createLayoutStructure() {
-    auto layout = setLayout(std::make_unique<Wt::WVBoxLayout>());
-    layout->setContentsMargins(0, 0, 0, 0);
-    layout->setSpacing(0);
-    
-    // Create navigation
-    navigation_ = layout->addWidget(std::make_unique<Components::Navigation>(
-        [this](const std::string& page) {
+    // Create navigation; .app-container stacks it above the content
+    navigation_ = addWidget(std::make_unique<Components::Navigation>(menu_,
+        [this](const std::string& path) {
             if (navigationCallback_) {
-                navigationCallback_(page);
+                navigationCallback_(path);
             }
         }
     ));
     
     // Create content stack
-    contentStack_ = layout->addWidget(std::make_unique<Wt::WStackedWidget>());
+    contentStack_ = addWidget(std::make_unique<Wt::WStackedWidget>());
     contentStack_->setStyleClass("content-stack");
 }
 
-void MainLayout::navigateToPage(const std::string& page) {
-    if (page == "home") {
-        contentStack_->setCurrentIndex(0);
-        navigation_->setActivePage("home");
-    } else if (page == "credits") {
-        contentStack_->setCurrentIndex(1);
-        navigation_->setActivePage("credits");
-    }
-}
-
 void MainLayout::setNavigationCallback(std::function<void(const std::string&)> callback) {
     navigationCallback_ = callback;
 }
@@ -2,6 +2,7 @@
 #include <Wt/WContainerWidget.h>
 #include <Wt/WStackedWidget.h>
 #include <functional>
+#include <memory>
 #include "../components/Navigation.h"
 
 namespace CSPNet {
@@ -10,16 +11,17 @@ namespace Layouts {
 
 class MainLayout : public Wt::WContainerWidget {
 public:
-    MainLayout();
+    explicit MainLayout(std::shared_ptr<const Components::NavigationMenu> menu);
     
     void setupLayout();
     Wt::WStackedWidget* getContentStack() { return contentStack_; }
     Components::Navigation* getNavigation() { return navigation_; }
     
-    void navigateToPage(const std::string& page);
+    // Receives the internal path of every navigation link that is clicked
     void setNavigationCallback(std::function<void(const std::string&)> callback);
     
 private:
+    std::shared_ptr<const Components::NavigationMenu> menu_;
     Components::Navigation* navigation_;
     Wt::WStackedWidget* contentStack_;
     std::function<void(const std::string&)> navigationCallback_;
@@ -16,7 +16,6 @@ private:
     void createPageStructure();
     void createHeroSection(Wt::WContainerWidget* parent);
     void createCreditsSection(Wt::WContainerWidget* parent);
-    void createCreditCard(Wt::WContainerWidget* parent, const std::string& name, const std::string& role);
     
     void setupPageStyles();
 };
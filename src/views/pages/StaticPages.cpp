@@ -0,0 +1,134 @@
+#include "StaticPages.h"
+#include "../../app/Routes.h"
+#include "../../models/ContentRepository.h"
+#include "../../models/ContentSnapshot.h"
+#include "../../styles/ThemeStyleSheet.h"
+#include "../../utils/Html.h"
+
+namespace CSPNet {
+namespace Views {
+namespace Pages {
+
+std::shared_ptr<const Assets::AssetManifest> StaticPages::render() {
+    auto home = Assets::AssetPipeline::compile("/index.html", renderHome(Models::AppData::getFeatures()));
+    home.url = homeUrl;
+    
+    // All credits when the snapshot holds them; from a database only the
+    // first page, the application pages through the rest
+    auto repository = Models::AppData::repository();
+    auto firstPage = repository->inSnapshot() ? Models::CreditPage{ Models::AppData::snapshot()->credits() }
+                                              : repository->credits(0, staticCreditLimit);
+    auto credits = Assets::AssetPipeline::compile("/credits.html",
+                                                  renderCredits(firstPage.credits, firstPage.next < 0));
+    credits.url = creditsUrl;
+    
+    auto queue = Assets::AssetPipeline::compile("/queue.html", renderQueue());
+    queue.url = queueUrl;
+    
+    std::vector<Assets::Asset> pages;
+    pages.push_back(std::move(home));
+    pages.push_back(std::move(credits));
+    pages.push_back(std::move(queue));
+    return std::make_shared<const Assets::AssetManifest>(std::move(pages));
+}
+
+std::string StaticPages::renderHome(const std::vector<Models::FeatureModel>& features) {
+    std::string html;
+    renderHero(html, "CSP-NET", "Premium Web Platform");
+    
+    html += "<div class=\"features\">";
+    for (const auto& feature : features) {
+        html += "<div class=\"feature-card\"><div class=\"feature-title\">";
+        Utils::appendHtmlEscaped(html, feature.title);
+        html += "</div><div class=\"feature-desc\">";
+        Utils::appendHtmlEscaped(html, feature.description);
+        html += "</div></div>";
+    }
+    html += "</div>";
+    
+    // The only entry into the session-backed application
+    html += "<form class=\"cta-section\" method=\"get\" action=\"";
+    html += enterUrl;
+    html += "\"><button class=\"cta-button\" type=\"submit\">Get Started</button></form>";
+    
+    return renderDocument("home", html);
+}
+
+std::string StaticPages::renderCredits(const std::vector<Models::CreditModel>& credits, bool complete) {
+    std::string html;
+    renderHero(html, "Credits", "Built with passion by");
+    
+    html += "<div class=\"credits-grid\">";
+    for (const auto& credit : credits) {
+        html += "<div class=\"credit-card\"><div class=\"credit-name\">";
+        Utils::appendHtmlEscaped(html, credit.name);
+        html += "</div><div class=\"credit-role\">";
+        Utils::appendHtmlEscaped(html, credit.role);
+        html += "</div></div>";
+    }
+    html += "</div>";
+    
+    if (!complete) {
+        html += "<form class=\"cta-section\" method=\"get\" action=\"";
+        html += enterUrl;
+        html += "\"><input type=\"hidden\" name=\"path\" value=\"";
+        html += App::Routes::creditsPath;
+        html += "\"><button class=\"cta-button\" type=\"submit\">See All Credits</button></form>";
+    }
+    
+    return renderDocument("credits", html);
+}
+
+std::string StaticPages::renderQueue() {
+    std::string html;
+    renderHero(html, "Almost there", "We are busy right now. You will enter automatically in a few seconds.");
+    
+    html += "<form class=\"cta-section\" method=\"get\" action=\"";
+    html += enterUrl;
+    html += "\"><button class=\"cta-button\" type=\"submit\">Try Again</button></form>";
+    
+    return renderDocument("", html, enterUrl);
+}
+
+std::string StaticPages::renderDocument(const std::string& activePage, const std::string& content,
+                                        const std::string& refreshUrl) {
+    std::string html =
+        "<!DOCTYPE html><html lang=\"en\"><head><meta charset=\"utf-8\">"
+        "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">"
+        "<title>CSP-NET • Premium Platform</title>";
+    if (!refreshUrl.empty()) {
+        html += "<meta http-equiv=\"refresh\" content=\"" + std::to_string(queueRetrySeconds) + ";url=";
+        Utils::appendHtmlEscaped(html, refreshUrl);
+        html += "\">";
+    }
+    html += "<link rel=\"stylesheet\" href=\"";
+    html += Styles::ThemeStyleSheet::url();
+    html += "\"></head><body><div class=\"app-container\">";
+    
+    // Same markup and classes as Views::Components::Navigation
+    html += "<div class=\"nav-bar\"><div class=\"nav-container\">"
+            "<span class=\"nav-logo\">CSP-NET</span><div class=\"nav-menu\">";
+    html += activePage == "home" ? "<a class=\"nav-item active\" href=\"" : "<a class=\"nav-item\" href=\"";
+    html += homeUrl;
+    html += "\">Home</a>";
+    html += activePage == "credits" ? "<a class=\"nav-item active\" href=\"" : "<a class=\"nav-item\" href=\"";
+    html += creditsUrl;
+    html += "\">Credits</a></div></div></div>";
+    
+    html += "<div class=\"page\"><div class=\"page-container\">";
+    html += content;
+    html += "</div></div></div></body></html>";
+    return html;
+}
+
+void StaticPages::renderHero(std::string& html, const std::string& title, const std::string& subtitle) {
+    html += "<div class=\"hero\"><div class=\"hero-title\">";
+    Utils::appendHtmlEscaped(html, title);
+    html += "</div><div class=\"hero-subtitle\">";
+    Utils::appendHtmlEscaped(html, subtitle);
+    html += "</div></div>";
+}
+
+} // namespace Pages
+} // namespace Views
+} // namespace CSPNet
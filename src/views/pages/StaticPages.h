@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../assets/AssetPipeline.h"
+#include "../../models/FeatureModel.h"
+
+namespace CSPNet {
+namespace Views {
+namespace Pages {
+
+// Home and Credits rendered once to plain HTML, so anonymous visitors are
+// served without a Wt session. Only "Get Started" leads into the
+// interactive application, through the admission gate, which is where a
+// session gets created.
+class StaticPages {
+public:
+    // Public URLs of the pre-rendered pages
+    static constexpr const char* homeUrl = "/";
+    static constexpr const char* creditsUrl = "/credits";
+    
+    // Entry into the application through the admission gate
+    static constexpr const char* enterUrl = "/enter";
+    
+    // Waiting page for visitors turned away under load; retries the gate
+    static constexpr const char* queueUrl = "/queue";
+    static constexpr int queueRetrySeconds = 5;
+    
+    // Credits pre-rendered from a database; the application has the rest
+    static constexpr std::size_t staticCreditLimit = 200;
+    
+    // Path of the interactive (session-backed) application
+    static constexpr const char* applicationUrl = "/app";
+    
+    // Renders both pages; each asset's url is its public URL
+    static std::shared_ptr<const Assets::AssetManifest> render();
+    
+    static std::string renderHome(const std::vector<Models::FeatureModel>& features);
+    // Without complete, the page ends with a link to the full list in the application
+    static std::string renderCredits(const std::vector<Models::CreditModel>& credits, bool complete = true);
+    static std::string renderQueue();
+    
+private:
+    static std::string renderDocument(const std::string& activePage, const std::string& content,
+                                      const std::string& refreshUrl = std::string());
+    static void renderHero(std::string& html, const std::string& title, const std::string& subtitle);
+};
+
+} // namespace Pages
+} // namespace Views
+} // namespace CSPNet